@@ -0,0 +1,579 @@
+// Throughput of strm against a hand-written lexer and std::regex, on generated inputs.
+// Build with optimizations (e.g. -DCMAKE_BUILD_TYPE=Release) for meaningful numbers.
+
+#include <strm/strm.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class tok : unsigned char {
+	#define KW(N) N##_,
+	#define SYM(S, NAME) NAME,
+
+	#include "lex.def"
+
+	#undef KW
+	#undef SYM
+
+	id,
+	int_num,
+	float_num,
+	invalid
+};
+
+#define STR2(X) #X
+#define STR(X) STR2(X)
+
+struct keyword { std::string_view name; tok kind; };
+struct symbol  { std::string_view str;  tok kind; };
+
+constexpr keyword keywords[] = {
+	#define KW(N)        { STR(N), tok::N##_ },
+	#define SYM(S, NAME)
+	#include "lex.def"
+	#undef KW
+	#undef SYM
+};
+
+constexpr symbol symbols[] = {
+	#define KW(N)
+	#define SYM(S, NAME) { S, tok::NAME },
+	#include "lex.def"
+	#undef KW
+	#undef SYM
+};
+
+// the number of tokens, and a checksum of their kinds so that nothing is optimized away
+struct lex_result
+{
+	std::size_t tokens = 0;
+	std::size_t checksum = 0;
+
+	void add(tok t) {
+		++tokens;
+		checksum = checksum * 31 + static_cast<std::size_t>(t);
+	}
+};
+
+// ==================================================================
+// inputs
+
+// a fixed seed and no distributions, so that the inputs are the same on every platform
+struct generator
+{
+	std::size_t operator()(std::size_t n) { return rng() % n; }
+
+	std::string identifier()
+	{
+		static constexpr std::string_view first = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_";
+		static constexpr std::string_view rest  = "abcdefghijklmnopqrstuvwxyz_0123456789";
+
+		std::string res(1, first[(*this)(first.size())]);
+		for (auto n = (*this)(12); n; --n)
+			res += rest[(*this)(rest.size())];
+		return res;
+	}
+
+	std::string number() { return std::to_string( (*this)(100000) ); }
+
+	std::string decimal() { return std::to_string( (*this)(10000) ) + "." + std::to_string( (*this)(1000) ); }
+
+	void separator(std::string& out)
+	{
+		switch ((*this)(16))
+		{
+			case 0 : out += "\n\t"; break;
+			case 1 : out += "\n"; break;
+			default : out += ' ';
+		}
+	}
+
+	std::mt19937 rng{ 42 };
+};
+
+std::string cpp_corpus(std::size_t size)
+{
+	generator gen;
+	std::string res;
+
+	while (res.size() < size)
+	{
+		const auto k = gen(10);
+
+		if (k < 3)
+			res += keywords[gen(std::size(keywords))].name;
+		else if (k < 6)
+			res += gen.identifier();
+		else if (k < 7)
+			res += gen.number();
+		else
+			res += symbols[gen(std::size(symbols))].str;
+
+		gen.separator(res);
+	}
+	return res;
+}
+
+std::string numbers_corpus(std::size_t size)
+{
+	generator gen;
+	std::string res;
+
+	while (res.size() < size)
+	{
+		res += gen(2) ? gen.number() : gen.decimal();
+		gen.separator(res);
+	}
+	return res;
+}
+
+// comma-separated cells : numbers, decimals and names
+std::string fields_corpus(std::size_t size)
+{
+	generator gen;
+	std::string res;
+
+	while (res.size() < size)
+	{
+		const auto k = gen(3);
+		res += (k == 0) ? gen.number() : (k == 1) ? gen.decimal() : gen.identifier();
+		res += ',';
+	}
+	return res;
+}
+
+std::string keywords_corpus(std::size_t size)
+{
+	generator gen;
+	std::string res;
+
+	while (res.size() < size)
+	{
+		res += keywords[gen(std::size(keywords))].name;
+		gen.separator(res);
+	}
+	return res;
+}
+
+// ==================================================================
+// strm lexers
+
+// input must be NUL-terminated
+template <class Backend>
+lex_result strm_cpp(std::string_view input)
+{
+	lex_result res;
+	const char* it = input.data();
+
+	while (true)
+	{
+		while (*it <= ' ' && *it != 0)
+			++it;
+
+		if (*it == 0)
+			break;
+
+		const char* start = it;
+
+		#define KW(N)         strm::lit<STR(N)>  >> tok::N##_,
+		#define SYM(S, NAME)  strm::lit<S>  >> tok::NAME,
+
+		auto t = strm::match<Backend>(
+			it,
+			tok::invalid,
+			#include "lex.def"
+			strm::identifier >> tok::id,
+			strm::int_num    >> tok::int_num
+		);
+
+		#undef KW
+		#undef SYM
+
+		if (it == start)
+			++it;
+
+		res.add(t);
+	}
+	return res;
+}
+
+lex_result strm_cpp_tokenizer(std::string_view input)
+{
+	#define KW(N)         strm::lit<STR(N)>  >> tok::N##_,
+	#define SYM(S, NAME)  strm::lit<S>  >> tok::NAME,
+
+	static auto lexer = strm::make_tokenizer<strm::table_backend>(
+		strm::whitespace,
+		tok::invalid,
+		#include "lex.def"
+		strm::identifier >> tok::id,
+		strm::int_num    >> tok::int_num
+	);
+
+	#undef KW
+	#undef SYM
+
+	lex_result res;
+	strm::token<tok> batch[256];
+	std::size_t pos = 0;
+
+	while (auto n = strm::tokenize(lexer, input, pos, batch))
+	{
+		for (std::size_t k = 0; k < n; ++k)
+			res.add(batch[k].kind);
+	}
+	return res;
+}
+
+template <class Backend>
+lex_result strm_numbers(std::string_view input)
+{
+	lex_result res;
+	const char* it = input.data();
+
+	while (true)
+	{
+		while (*it <= ' ' && *it != 0)
+			++it;
+
+		if (*it == 0)
+			break;
+
+		const char* start = it;
+
+		auto t = strm::match<Backend>(
+			it,
+			tok::invalid,
+			strm::int_num   >> tok::int_num,
+			strm::float_num >> tok::float_num
+		);
+
+		if (it == start)
+			++it;
+
+		res.add(t);
+	}
+	return res;
+}
+
+// the cells of the input, split on commas
+std::vector<std::string_view>& split_fields(std::string_view input)
+{
+	static std::vector<std::string_view> cells;
+	cells.clear();
+
+	for (std::size_t k = 0, comma; (comma = input.find(',', k)) != std::string_view::npos; k = comma + 1)
+		cells.push_back(input.substr(k, comma - k));
+	return cells;
+}
+
+#define FIELD_CASES \
+	tok::invalid, \
+	strm::int_num    >> tok::int_num, \
+	strm::float_num  >> tok::float_num, \
+	strm::identifier >> tok::id
+
+lex_result strm_fields(std::string_view input)
+{
+	lex_result res;
+
+	for (auto cell : split_fields(input))
+		res.add( strm::match<strm::table_backend>(cell, FIELD_CASES) );
+	return res;
+}
+
+lex_result strm_fields_batch(std::string_view input)
+{
+	static std::vector<tok> kinds;
+
+	auto& cells = split_fields(input);
+	kinds.resize(cells.size());
+	strm::match_batch(cells, kinds.begin(), FIELD_CASES);
+
+	lex_result res;
+	for (auto t : kinds)
+		res.add(t);
+	return res;
+}
+
+#undef FIELD_CASES
+
+// ==================================================================
+// hand-written lexers
+
+bool is_ident_char(char c) {
+	return strm::is_letter(c) || strm::is_digit(c) || c == '_';
+}
+
+tok hand_keyword(std::string_view word)
+{
+	static const auto sorted = [] {
+		std::array<keyword, std::size(keywords)> res;
+		std::copy(std::begin(keywords), std::end(keywords), res.begin());
+		std::sort(res.begin(), res.end(), [] (auto& a, auto& b) { return a.name < b.name; });
+		return res;
+	}();
+
+	auto it = std::lower_bound(sorted.begin(), sorted.end(), word,
+		[] (const keyword& k, std::string_view w) { return k.name < w; });
+
+	return (it != sorted.end() && it->name == word) ? it->kind : tok::id;
+}
+
+lex_result hand_cpp(std::string_view input)
+{
+	lex_result res;
+	const char* it = input.data();
+
+	while (true)
+	{
+		while (*it <= ' ' && *it != 0)
+			++it;
+
+		if (*it == 0)
+			break;
+
+		tok t = tok::invalid;
+
+		switch (*it)
+		{
+			case '&' : t = (it[1] == '&') ? (++it, tok::logical_and) : tok::bitand_; break;
+			case '|' : t = (it[1] == '|') ? (++it, tok::logical_or) : tok::bitor_; break;
+			case '=' : t = (it[1] == '=') ? (++it, tok::eq) : tok::assign; break;
+			case ':' : t = (it[1] == ':') ? (++it, tok::double_colon) : tok::colon; break;
+			case '!' : t = (it[1] == '=') ? (++it, tok::neq) : tok::invalid; break;
+			case '.' : t = (it[1] == '.' && it[2] == '.') ? (it += 2, tok::ellipsis) : tok::dot; break;
+			case '+' : t = tok::plus; break;
+			case '-' : t = tok::sub; break;
+			case '*' : t = tok::mult; break;
+			case '/' : t = tok::div; break;
+			case '<' : t = tok::lesser; break;
+			case '>' : t = tok::greater; break;
+			case '{' : t = tok::lbrace; break;
+			case '}' : t = tok::rbrace; break;
+			case '(' : t = tok::lparens; break;
+			case ')' : t = tok::rparens; break;
+			case '[' : t = tok::lbracket; break;
+			case ']' : t = tok::rbracket; break;
+			case ',' : t = tok::comma; break;
+			case ';' : t = tok::semicolon; break;
+			case '?' : t = tok::question; break;
+
+			default :
+				if (strm::is_digit(*it))
+				{
+					while (strm::is_digit(it[1]))
+						++it;
+					t = tok::int_num;
+				}
+				else if (strm::is_letter(*it) || *it == '_')
+				{
+					const char* start = it;
+					while (is_ident_char(it[1]))
+						++it;
+					t = hand_keyword({start, std::size_t(it + 1 - start)});
+				}
+		}
+
+		++it;
+		res.add(t);
+	}
+	return res;
+}
+
+lex_result hand_numbers(std::string_view input)
+{
+	lex_result res;
+	const char* it = input.data();
+
+	while (true)
+	{
+		while (*it <= ' ' && *it != 0)
+			++it;
+
+		if (*it == 0)
+			break;
+
+		tok t = tok::invalid;
+
+		if (strm::is_digit(*it) || *it == '.')
+		{
+			t = tok::int_num;
+
+			while (strm::is_digit(*it))
+				++it;
+
+			if (*it == '.')
+			{
+				t = tok::float_num;
+				++it;
+				while (strm::is_digit(*it))
+					++it;
+			}
+		}
+		else
+			++it;
+
+		res.add(t);
+	}
+	return res;
+}
+
+// ==================================================================
+// std::regex
+
+std::string escape(std::string_view str)
+{
+	std::string res;
+	for (char c : str)
+	{
+		if (std::string_view{"\\^$.|?*+()[]{}"}.find(c) != std::string_view::npos)
+			res += '\\';
+		res += c;
+	}
+	return res;
+}
+
+const std::regex& cpp_regex()
+{
+	static const std::regex re = [] {
+		std::string pattern = "(?:";
+
+		for (auto& k : keywords)
+			pattern += std::string(k.name) + '|';
+		pattern.back() = ')';
+		pattern += "\\b|[A-Za-z_]\\w*|\\d+";
+
+		// longest first, since alternatives are tried in order
+		auto sorted = std::vector<symbol>(std::begin(symbols), std::end(symbols));
+		std::stable_sort(sorted.begin(), sorted.end(), [] (auto& a, auto& b) { return a.str.size() > b.str.size(); });
+
+		for (auto& s : sorted)
+			pattern += '|' + escape(s.str);
+
+		return std::regex(pattern);
+	}();
+	return re;
+}
+
+lex_result regex_lex(std::string_view input, const std::regex& re)
+{
+	lex_result res;
+	auto it = input.begin();
+	const auto end = input.end();
+	std::match_results<std::string_view::const_iterator> m;
+
+	while (true)
+	{
+		while (it != end && *it <= ' ')
+			++it;
+
+		if (it == end)
+			break;
+
+		if (not std::regex_search(it, end, m, re, std::regex_constants::match_continuous) || m.length(0) == 0)
+		{
+			++it;
+			res.add(tok::invalid);
+			continue;
+		}
+
+		it += m.length(0);
+		res.add(tok::id);
+	}
+	return res;
+}
+
+lex_result regex_cpp(std::string_view input) {
+	return regex_lex(input, cpp_regex());
+}
+
+lex_result regex_numbers(std::string_view input)
+{
+	static const std::regex re{ "\\d+\\.?\\d*|\\.\\d*" };
+	return regex_lex(input, re);
+}
+
+// ==================================================================
+
+struct lexer
+{
+	const char* name;
+	lex_result (*fn)(std::string_view);
+
+	// std::regex is much slower, it is only run on a prefix of the input
+	bool slow = false;
+};
+
+void run(const char* workload, const std::string& input, std::initializer_list<lexer> lexers, int reps)
+{
+	std::printf("\n%s (%zu bytes)\n", workload, input.size());
+
+	for (auto& lex : lexers)
+	{
+		// keep the input NUL-terminated for the lexers which rely on it
+		const std::string slice = lex.slow ? input.substr(0, input.size() / 16) : std::string{};
+		const std::string_view in = lex.slow ? std::string_view{slice} : std::string_view{input};
+
+		double best = 1e300;
+		lex_result res;
+
+		for (int k = 0; k < reps; ++k)
+		{
+			auto t0 = std::chrono::steady_clock::now();
+			res = lex.fn(in);
+			auto t1 = std::chrono::steady_clock::now();
+			best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+		}
+
+		std::printf("  %-16s %10.1f MB/s %10.2f ns/token %10zu tokens\n",
+			lex.name,
+			in.size() / best / 1e6,
+			best * 1e9 / std::max<std::size_t>(res.tokens, 1),
+			res.tokens);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	// size of the inputs in MB
+	const std::size_t mb = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 8;
+	const std::size_t size = std::max<std::size_t>(mb, 1) << 20;
+	const int reps = 5;
+
+	run("c++ lexer", cpp_corpus(size), {
+		{ "strm switch",    strm_cpp<strm::switch_backend> },
+		{ "strm table",     strm_cpp<strm::table_backend> },
+		{ "strm tokenizer", strm_cpp_tokenizer },
+		{ "hand-written",   hand_cpp },
+		{ "std::regex",     regex_cpp, true }
+	}, reps);
+
+	run("numbers", numbers_corpus(size), {
+		{ "strm switch",  strm_numbers<strm::switch_backend> },
+		{ "strm table",   strm_numbers<strm::table_backend> },
+		{ "hand-written", hand_numbers },
+		{ "std::regex",   regex_numbers, true }
+	}, reps);
+
+	run("fields", fields_corpus(size), {
+		{ "strm table",  strm_fields },
+		{ "strm batch",  strm_fields_batch }
+	}, reps);
+
+	run("keywords", keywords_corpus(size), {
+		{ "strm switch",    strm_cpp<strm::switch_backend> },
+		{ "strm table",     strm_cpp<strm::table_backend> },
+		{ "strm tokenizer", strm_cpp_tokenizer },
+		{ "hand-written",   hand_cpp },
+		{ "std::regex",     regex_cpp, true }
+	}, reps);
+}
@@ -0,0 +1,186 @@
+#ifndef STRM_CPP_LIBRARY_DEBUG_HEADER
+#define STRM_CPP_LIBRARY_DEBUG_HEADER
+
+#include "strm.hpp"
+
+#include <ostream>
+#include <string>
+
+namespace strm {
+
+///
+/// The size of the automaton of a set of matchers, as flattened by the table backend.
+/// The states of the switch backend are about the same, each with a switch over max_range characters at most.
+///
+struct automaton_stats
+{
+	std::size_t states = 0;      // the states reachable from the start, without the dead state
+	std::size_t classes = 0;     // the classes of characters which every state treats the same way
+	std::size_t transitions = 0; // the pairs of a state and a character which continue the match
+	int max_range = 0;           // the widest range of characters on which a state continues
+	std::size_t table_bytes = 0; // the size of the table of the table backend
+};
+
+namespace impl {
+
+	template <auto... Matchers>
+	constexpr automaton_stats make_stats()
+	{
+		const auto dfa = impl::build_dfa<false, Matchers...>();
+		const int classes = dfa.classes.count;
+
+		automaton_stats res;
+		res.states = dfa.states - 1;
+		res.classes = classes;
+
+		for (std::size_t s = 1; s < dfa.states; ++s)
+		{
+			int lo = 128, hi = -129;
+
+			for (int b = 0; b < 256; ++b)
+			{
+				if (dfa.next[s * classes + dfa.classes.of[b]] == 0)
+					continue;
+
+				++res.transitions;
+
+				// characters are ordered as chars by the switch
+				const int c = static_cast<char>(b);
+				lo = c < lo ? c : lo;
+				hi = c > hi ? c : hi;
+			}
+
+			if (lo <= hi && hi - lo + 1 > res.max_range)
+				res.max_range = hi - lo + 1;
+		}
+		return res;
+	}
+
+	// a character in a character class, escaped if needed
+	inline void append_class_char(std::string& out, int b)
+	{
+		if (b == '[' || b == ']' || b == '-' || b == '\\' || b == '^')
+		{
+			out += '\\';
+			out += static_cast<char>(b);
+		}
+		else if (b > ' ' && b < 127)
+		{
+			out += static_cast<char>(b);
+		}
+		else
+		{
+			constexpr char hex[] = "0123456789ABCDEF";
+			out += "\\x";
+			out += hex[b / 16];
+			out += hex[b % 16];
+		}
+	}
+
+	// the characters of a transition, as a character class
+	inline std::string class_label(const bool (&bytes)[256])
+	{
+		std::string res;
+		int count = 0;
+
+		for (int b = 0; b < 256; ++b)
+		{
+			if (not bytes[b])
+				continue;
+
+			int last = b;
+			while (last + 1 < 256 && bytes[last + 1]) ++last;
+
+			impl::append_class_char(res, b);
+			if (last > b)
+			{
+				if (last > b + 1) res += '-';
+				impl::append_class_char(res, last);
+			}
+
+			count += last - b + 1;
+			b = last;
+		}
+
+		return (count == 1) ? res : "[" + res + "]";
+	}
+
+	// a string quoted for DOT
+	inline std::string dot_quoted(const std::string& str)
+	{
+		std::string res = "\"";
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\') res += '\\';
+			res += c;
+		}
+		return res + '"';
+	}
+
+} // IMPL
+
+///
+/// The statistics of the automaton of a set of matchers, e.g. to check that it doesn't blow up :
+/// static_assert( strm::stats<strm::lit<"if">, strm::identifier>.states < 100 );
+///
+template <auto... Matchers>
+inline constexpr automaton_stats stats = [] {
+	constexpr auto res = impl::make_stats<Matchers...>();
+
+	auto with_size = res;
+	with_size.table_bytes = sizeof( impl::dfa_table<res.states + 1, res.classes> );
+	return with_size;
+}();
+
+///
+/// Write the automaton of a set of matchers in the DOT format of Graphviz (e.g. for dot -Tsvg).
+/// The states are numbered as in the table backend, 1 being the starting state,
+/// and the accepting states are labelled with the index of the matcher which matches there.
+/// The automaton is built at runtime, so this doesn't add to the compile time.
+///
+template <auto... Matchers>
+void write_dot(std::ostream& out)
+{
+	const auto dfa = impl::build_dfa<false, Matchers...>();
+	const int classes = dfa.classes.count;
+
+	out << "digraph strm {\n";
+	out << "\trankdir=LR;\n";
+	out << "\tnode [shape=circle];\n";
+	out << "\tstart [shape=point];\n";
+	out << "\tstart -> 1;\n";
+
+	for (std::size_t s = 1; s < dfa.states; ++s)
+	{
+		if (dfa.accept[s] != -1)
+			out << '\t' << s << " [shape=doublecircle, label=\"" << s << "\\n" << dfa.accept[s] << "\"];\n";
+	}
+
+	for (std::size_t s = 1; s < dfa.states; ++s)
+	{
+		// a single edge to each next state, with all the characters which lead there
+		bool done[256] = {};
+
+		for (int b = 0; b < 256; ++b)
+		{
+			const auto next = dfa.next[s * classes + dfa.classes.of[b]];
+			if (done[b] || next == 0)
+				continue;
+
+			bool bytes[256] = {};
+			for (int k = b; k < 256; ++k)
+			{
+				if (dfa.next[s * classes + dfa.classes.of[k]] == next)
+					bytes[k] = done[k] = true;
+			}
+
+			out << '\t' << s << " -> " << next << " [label=" << impl::dot_quoted(impl::class_label(bytes)) << "];\n";
+		}
+	}
+
+	out << "}\n";
+}
+
+} // STRM
+
+#endif
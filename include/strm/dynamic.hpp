@@ -0,0 +1,340 @@
+#ifndef STRM_CPP_LIBRARY_DYNAMIC_HEADER
+#define STRM_CPP_LIBRARY_DYNAMIC_HEADER
+
+#include "regex.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace strm {
+
+///
+/// A pattern only known at runtime (read from a configuration file...) :
+/// a literal, or a regular expression with the syntax of strm::re
+///
+struct runtime_pattern
+{
+	std::string text;
+	bool regex = false;
+};
+
+inline runtime_pattern runtime_lit(std::string_view str) { return { std::string(str), false }; }
+inline runtime_pattern runtime_re(std::string_view str)  { return { std::string(str), true }; }
+
+template <class Result>
+struct dynamic_case
+{
+	runtime_pattern pattern;
+	Result result;
+};
+
+template <class Result>
+dynamic_case<Result> operator >> (runtime_pattern pattern, Result result) {
+	return { std::move(pattern), std::move(result) };
+}
+
+namespace impl {
+
+	// The automaton of the patterns of a dynamic_matcher.
+	// State 0 is the dead state, state 1 the starting one,
+	// accept[s] is the index of the case accepted in state s (-1 for none).
+	struct dynamic_dfa
+	{
+		std::size_t states = 0;
+		int classes = 0;
+		unsigned char class_of[256] {};
+		std::vector<std::uint32_t> next; // [state * classes + class]
+		std::vector<int> accept;
+	};
+
+	// Thompson's construction of every pattern, then the subset construction and the minimization,
+	// as for a regex_matcher, but at runtime. same[k] is the first case with the same result as case k :
+	// the states which accept them are merged.
+	inline dynamic_dfa build_dynamic_dfa(const std::vector<runtime_pattern>& patterns, const std::vector<int>& same)
+	{
+		regex_nfa nfa;
+		std::vector<int> ends; // the end state of each pattern
+
+		// every state has at most two epsilon transitions, so the patterns hang off a chain of forks
+		const int start = nfa.add_state();
+		int fork = start;
+
+		for (const auto& p : patterns)
+		{
+			int first, last;
+
+			if (p.regex)
+			{
+				regex_parser parser{p.text.data(), static_cast<int>(p.text.size())};
+				const auto f = parser.parse();
+
+				const int offset = nfa.size();
+				auto shift = [&] (int s) { return (s == -1) ? -1 : s + offset; };
+
+				for (std::size_t s = 0; s < parser.nfa.size(); ++s)
+				{
+					const int n = nfa.add_state();
+					nfa.bytes[n] = parser.nfa.bytes[s];
+					nfa.out[n]   = shift(parser.nfa.out[s]);
+					nfa.eps1[n]  = shift(parser.nfa.eps1[s]);
+					nfa.eps2[n]  = shift(parser.nfa.eps2[s]);
+				}
+				first = f.start + offset;
+				last  = f.end + offset;
+			}
+			else
+			{
+				first = last = nfa.add_state();
+
+				for (char c : p.text)
+				{
+					const int n = nfa.add_state();
+					const auto b = static_cast<unsigned char>(c);
+
+					// a zero byte is a character of the literal, the NUL-terminated match stops before it
+					nfa.bytes[last].add(b, b);
+					nfa.out[last] = n;
+					last = n;
+				}
+			}
+
+			const int next_fork = nfa.add_state();
+			nfa.add_epsilon(fork, first);
+			nfa.add_epsilon(fork, next_fork);
+			fork = next_fork;
+			ends.push_back(last);
+		}
+
+		std::vector<int> accept_of(nfa.size(), -1);
+		for (std::size_t k = ends.size(); k-- != 0;)
+			accept_of[ends[k]] = k;
+
+		partition p(256);
+		buffer<int> outcome;
+		for (std::size_t n = 0; n < nfa.size(); ++n)
+		{
+			if (nfa.bytes[n].empty())
+				continue;
+
+			outcome.clear();
+			for (int b = 0; b < 256; ++b)
+				outcome.push_back(nfa.bytes[n].has(b));
+			p.refine(0, outcome);
+		}
+		const byte_classes<256> classes{p};
+
+		// the subset construction, the sets of nfa states are sorted
+		struct set_hash
+		{
+			std::size_t operator()(const std::vector<int>& set) const {
+				return impl::hash_state(set.data(), set.data() + set.size());
+			}
+		};
+
+		std::vector<std::vector<int>> sets(1); // the dead state has no nfa state
+		std::unordered_map<std::vector<int>, int, set_hash> index;
+
+		std::vector<unsigned> stamp(nfa.size(), 0);
+		unsigned round = 0;
+
+		auto add = [&] (std::vector<int>& set, int s)
+		{
+			if (stamp[s] != round)
+			{
+				stamp[s] = round;
+				set.push_back(s);
+			}
+		};
+
+		auto find_or_insert = [&] (std::vector<int>& set) -> int
+		{
+			for (std::size_t k = 0; k < set.size(); ++k)
+				for (int e : {nfa.eps1[set[k]], nfa.eps2[set[k]]})
+					if (e != -1) add(set, e);
+
+			if (set.empty())
+				return 0;
+
+			std::sort(set.begin(), set.end());
+
+			auto [it, inserted] = index.try_emplace(set, sets.size());
+			if (inserted)
+				sets.push_back(set);
+			return it->second;
+		};
+
+		std::vector<int> set;
+		++round;
+		set.push_back(start);
+		stamp[start] = round;
+		find_or_insert(set);
+
+		buffer<int> next, label;
+
+		// the dead state is labelled apart, so that it stays state 0, and the starting state 1
+		for (int c = 0; c < classes.count; ++c)
+			next.push_back(0);
+		label.push_back(-2);
+
+		for (std::size_t s = 1; s < sets.size(); ++s)
+		{
+			int accept = -1;
+			for (int n : sets[s])
+				if (accept_of[n] != -1 && (accept == -1 || accept_of[n] < accept)) accept = accept_of[n];
+			label.push_back( (accept == -1) ? -1 : same[accept] );
+
+			for (int c = 0; c < classes.count; ++c)
+			{
+				const int b = classes.rep[c];
+
+				++round;
+				set.clear();
+				for (int n : sets[s])
+					if (nfa.out[n] != -1 && nfa.bytes[n].has(b)) add(set, nfa.out[n]);
+
+				next.push_back( find_or_insert(set) );
+			}
+		}
+
+		const auto block = impl::equivalent_states(sets.size(), classes.count, next, label);
+
+		dynamic_dfa res;
+		res.classes = classes.count;
+		for (int b = 0; b < 256; ++b)
+			res.class_of[b] = classes.of[b];
+
+		for (std::size_t s = 0; s < sets.size(); ++s)
+		{
+			if (block[s] != int(res.states))
+				continue;
+
+			++res.states;
+			res.accept.push_back( (s == 0) ? -1 : label[s] );
+
+			for (int c = 0; c < classes.count; ++c)
+				res.next.push_back( block[ next[s * classes.count + c] ] );
+		}
+		return res;
+	}
+
+} // IMPL
+
+///
+/// An automaton built at runtime, from patterns which aren't known at compile-time.
+/// The patterns are compiled once, in the constructor, into a minimal DFA walked like the table backend :
+/// matching doesn't allocate or hash anything. As with strm::match, the longest match wins,
+/// and the first case on a tie. Throws a regex_syntax_error if a regular expression is invalid.
+///
+template <class Result>
+class dynamic_matcher
+{
+	public :
+
+	dynamic_matcher(Result default_, std::vector<dynamic_case<Result>> cases)
+	: default_{std::move(default_)}
+	{
+		std::vector<runtime_pattern> patterns;
+		std::vector<int> same;
+		for (auto& c : cases)
+		{
+			int k = results_.size();
+			if constexpr ( std::equality_comparable<Result> )
+				k = std::find(results_.begin(), results_.end(), c.result) - results_.begin();
+
+			same.push_back(k);
+			patterns.push_back( std::move(c.pattern) );
+			results_.push_back( std::move(c.result) );
+		}
+		dfa_ = impl::build_dynamic_dfa(patterns, same);
+	}
+
+	///
+	/// Match a NUL-terminated input
+	///
+	template <stream Iter>
+	const Result& match(Iter& src) const {
+		return run(src, std::unreachable_sentinel);
+	}
+
+	///
+	/// Match the range [src, end)
+	///
+	template <stream Iter, sentinel_for<Iter> Sent>
+	const Result& match(Iter& src, Sent end) const {
+		return run(src, end);
+	}
+
+	///
+	/// Match the beginning of a string_view, and remove the consumed characters from it
+	///
+	const Result& match(std::string_view& src) const
+	{
+		auto it = src.data();
+		const auto& res = run(it, src.data() + src.size());
+		src.remove_prefix(it - src.data());
+		return res;
+	}
+
+	// the number of states of the automaton, including the dead state
+	std::size_t states() const { return dfa_.states; }
+
+	private :
+
+	template <class Iter, class Sent>
+	const Result& run(Iter& src, const Sent& end) const
+	{
+		const auto classes = static_cast<std::size_t>(dfa_.classes);
+
+		std::size_t state = 1;
+		std::size_t accept_state = 0;
+		Iter accepted_src = src;
+
+		while (true)
+		{
+			if (dfa_.accept[state] != -1)
+			{
+				accept_state = state;
+				accepted_src = src;
+			}
+
+			if constexpr ( not std::is_same_v<Sent, std::unreachable_sentinel_t> )
+			{
+				if (src == end)
+					break;
+			}
+
+			const auto c = static_cast<unsigned char>( static_cast<char>(*src) );
+
+			// the zero byte ends NUL-terminated inputs, even if a literal goes on with it
+			if constexpr ( std::is_same_v<Sent, std::unreachable_sentinel_t> )
+			{
+				if (c == 0)
+					break;
+			}
+
+			state = dfa_.next[state * classes + dfa_.class_of[c]];
+
+			if (state == 0)
+				break;
+
+			++src;
+		}
+
+		if (accept_state == 0)
+			return default_;
+
+		src = accepted_src;
+		return results_[ dfa_.accept[accept_state] ];
+	}
+
+	impl::dynamic_dfa dfa_;
+	std::vector<Result> results_;
+	Result default_;
+};
+
+} // STRM
+
+#endif
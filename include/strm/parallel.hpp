@@ -0,0 +1,191 @@
+#ifndef STRM_CPP_LIBRARY_PARALLEL_HEADER
+#define STRM_CPP_LIBRARY_PARALLEL_HEADER
+
+#include "strm.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace strm {
+
+struct parallel_options
+{
+	// number of threads, 0 for std::thread::hardware_concurrency()
+	unsigned threads = 0;
+
+	// approximate size of the chunks lexed by each task
+	std::size_t chunk_size = std::size_t{1} << 20;
+
+	// if not empty, chunks begin right after one of these characters (e.g. "\n"),
+	// which makes it likely that they begin on a token boundary
+	std::string_view sync = {};
+};
+
+namespace impl {
+
+	template <class Token>
+	struct chunk_tokens
+	{
+		std::vector<Token> tokens;
+
+		// the offset of the first token past the chunk
+		std::size_t stop = 0;
+	};
+
+	// the first token of the chunk which begins at offset, if any
+	template <class Token>
+	auto find_token(const std::vector<Token>& tokens, std::size_t offset)
+	{
+		auto it = std::lower_bound(tokens.begin(), tokens.end(), offset,
+			[] (const Token& t, std::size_t o) { return t.offset < o; }
+		);
+		return (it != tokens.end() && it->offset == offset) ? it : tokens.end();
+	}
+
+} // IMPL
+
+///
+/// Lex a large input on several threads. The result is identical to lexing it sequentially.
+///
+/// The input is split into chunks, and each chunk is lexed speculatively from its start.
+/// Then the chunks are stitched together : the lexing of a chunk is valid from the first token
+/// which begins where the previous chunk stopped, since lexing from a given position always gives
+/// the same tokens. When no such token exists, the chunk is lexed again sequentially until it
+/// falls back in step.
+///
+template <class Options, class Skip, class Default, class... Cases>
+auto parallel_tokenize(
+	const tokenizer<Options, Skip, Default, Cases...>& lexer,
+	std::string_view input,
+	parallel_options opts = {})
+{
+	using token_type = typename tokenizer<Options, Skip, Default, Cases...>::token_type;
+
+	const std::size_t size = input.size();
+	const std::size_t chunk_size = std::max<std::size_t>(opts.chunk_size, 1);
+	const std::size_t num_chunks = std::max<std::size_t>((size + chunk_size - 1) / chunk_size, 1);
+
+	// where the lexing of each chunk begins
+	std::vector<std::size_t> starts(num_chunks + 1, size);
+	starts[0] = 0;
+
+	for (std::size_t k = 1; k < num_chunks; ++k)
+	{
+		const auto first = k * chunk_size;
+		const auto last  = std::min(first + chunk_size, size);
+		starts[k] = first;
+
+		if (not opts.sync.empty())
+		{
+			auto p = input.substr(first, last - first).find_first_of(opts.sync);
+			if (p != std::string_view::npos)
+				starts[k] = first + p + 1;
+		}
+	}
+
+	std::vector< impl::chunk_tokens<token_type> > chunks(num_chunks);
+
+	auto lex_chunk = [&] (std::size_t k)
+	{
+		auto lex = lexer;
+		auto& chunk = chunks[k];
+		const auto limit = starts[k + 1];
+
+		token_type batch[256];
+		std::size_t pos = starts[k];
+
+		while (auto n = lex(input, pos, batch))
+		{
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				if (batch[i].offset >= limit)
+				{
+					chunk.stop = batch[i].offset;
+					return;
+				}
+				chunk.tokens.push_back(batch[i]);
+			}
+		}
+
+		chunk.stop = size;
+	};
+
+	unsigned threads = opts.threads ? opts.threads : std::thread::hardware_concurrency();
+	threads = static_cast<unsigned>( std::clamp<std::size_t>(threads, 1, num_chunks) );
+
+	std::atomic<std::size_t> next_chunk = 0;
+
+	auto work = [&] {
+		for (auto k = next_chunk++; k < num_chunks; k = next_chunk++)
+			lex_chunk(k);
+	};
+
+	{
+		std::vector<std::thread> pool;
+		for (unsigned t = 1; t < threads; ++t)
+			pool.emplace_back(work);
+
+		work();
+
+		for (auto& t : pool)
+			t.join();
+	}
+
+	// stitch the chunks together
+
+	std::vector<token_type> res = std::move(chunks[0].tokens);
+	std::size_t expected = chunks[0].stop;
+	auto lex = lexer;
+
+	for (std::size_t k = 1; k < num_chunks && expected < size; ++k)
+	{
+		const auto& tokens = chunks[k].tokens;
+		const auto limit = starts[k + 1];
+
+		if (expected >= limit)
+			continue;
+
+		if (auto it = impl::find_token(tokens, expected); it != tokens.end())
+		{
+			res.insert(res.end(), it, tokens.end());
+			expected = chunks[k].stop;
+			continue;
+		}
+
+		// the chunk didn't begin on a token boundary, lex it until it does
+		std::size_t pos = expected;
+		token_type t;
+
+		while (true)
+		{
+			if (lex(input, pos, std::span(&t, 1)) == 0)
+			{
+				expected = size;
+				break;
+			}
+
+			if (t.offset >= limit)
+			{
+				expected = t.offset;
+				break;
+			}
+
+			if (auto it = impl::find_token(tokens, t.offset); it != tokens.end())
+			{
+				res.insert(res.end(), it, tokens.end());
+				expected = chunks[k].stop;
+				break;
+			}
+
+			res.push_back(t);
+		}
+	}
+
+	return res;
+}
+
+} // STRM
+
+#endif
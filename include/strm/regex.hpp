@@ -0,0 +1,709 @@
+#ifndef STRM_CPP_LIBRARY_REGEX_HEADER
+#define STRM_CPP_LIBRARY_REGEX_HEADER
+
+#include "strm.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+
+namespace strm {
+
+///
+/// Thrown when a pattern compiled at runtime (see dynamic_matcher) isn't a valid regular expression
+///
+struct regex_syntax_error : std::invalid_argument
+{
+	using std::invalid_argument::invalid_argument;
+};
+
+namespace impl {
+
+	// not constexpr : calling it while compiling a pattern stops the compilation,
+	// and the error points here with the message. At runtime, the parse stops with an exception.
+	[[noreturn]] inline void regex_error(const char* msg)
+	{
+	#if defined(__cpp_exceptions)
+		throw regex_syntax_error{msg};
+	#else
+		(void)msg;
+		std::abort();
+	#endif
+	}
+
+	// a set of bytes
+	struct byte_set
+	{
+		constexpr void add(int lo, int hi) {
+			for (int b = lo; b <= hi; ++b) bits[b / 64] |= std::uint64_t{1} << (b % 64);
+		}
+
+		constexpr bool has(int b) const { return (bits[b / 64] >> (b % 64)) & 1; }
+
+		constexpr bool empty() const { return not (bits[0] | bits[1] | bits[2] | bits[3]); }
+
+		constexpr byte_set operator~() const
+		{
+			byte_set res;
+			for (int k = 0; k < 4; ++k) res.bits[k] = ~bits[k];
+			return res;
+		}
+
+		constexpr byte_set& operator|=(const byte_set& o)
+		{
+			for (int k = 0; k < 4; ++k) bits[k] |= o.bits[k];
+			return *this;
+		}
+
+		std::uint64_t bits[4] {};
+	};
+
+	// Thompson's construction : every state has either a transition over a set of bytes,
+	// or up to two epsilon transitions
+	struct regex_nfa
+	{
+		constexpr int add_state()
+		{
+			bytes.push_back({});
+			out.push_back(-1);
+			eps1.push_back(-1);
+			eps2.push_back(-1);
+			return bytes.size() - 1;
+		}
+
+		constexpr void add_epsilon(int from, int to)
+		{
+			if (eps2[from] != -1)
+				regex_error("too many epsilon transitions");
+			(eps1[from] == -1 ? eps1[from] : eps2[from]) = to;
+		}
+
+		constexpr std::size_t size() const { return bytes.size(); }
+
+		buffer<byte_set> bytes;
+		buffer<int> out;
+		buffer<int> eps1, eps2;
+	};
+
+	// A part of the automaton, made of the states [first, last).
+	// The end state has no transition yet.
+	struct regex_fragment
+	{
+		int start, end;
+		int first, last;
+	};
+
+	struct regex_parser
+	{
+		constexpr regex_parser(const char* str, int size) : str{str}, size{size} {}
+
+		constexpr regex_fragment parse()
+		{
+			auto res = alternation();
+			if (pos != size)
+				regex_error("unbalanced parenthesis");
+			return res;
+		}
+
+		private :
+
+		constexpr bool at_end() const { return pos == size; }
+		constexpr char peek() const { return str[pos]; }
+
+		constexpr regex_fragment alternation()
+		{
+			auto res = concatenation();
+
+			while (not at_end() && peek() == '|')
+			{
+				++pos;
+				auto rhs = concatenation();
+
+				const int start = nfa.add_state(), end = nfa.add_state();
+				nfa.add_epsilon(start, res.start);
+				nfa.add_epsilon(start, rhs.start);
+				nfa.add_epsilon(res.end, end);
+				nfa.add_epsilon(rhs.end, end);
+
+				res = { start, end, res.first, end + 1 };
+			}
+			return res;
+		}
+
+		constexpr regex_fragment concatenation()
+		{
+			const int first = nfa.size();
+			const int empty = nfa.add_state();
+			regex_fragment res = { empty, empty, first, first + 1 };
+
+			while (not at_end() && peek() != '|' && peek() != ')')
+			{
+				auto rhs = repetition();
+				nfa.add_epsilon(res.end, rhs.start);
+				res = { res.start, rhs.end, first, rhs.last };
+			}
+			return res;
+		}
+
+		constexpr regex_fragment repetition()
+		{
+			auto res = atom();
+
+			while (not at_end())
+			{
+				int min = 0, max = -1;
+
+				switch (peek())
+				{
+					case '*' : ++pos; break;
+					case '+' : ++pos; min = 1; break;
+					case '?' : ++pos; max = 1; break;
+					case '{' : bounds(min, max); break;
+					default  : return res;
+				}
+
+				res = repeat(res, min, max);
+			}
+			return res;
+		}
+
+		// {n}, {n,} or {n,m}
+		constexpr void bounds(int& min, int& max)
+		{
+			++pos;
+			min = number();
+			max = min;
+
+			if (not at_end() && peek() == ',')
+			{
+				++pos;
+				max = (not at_end() && peek() == '}') ? -1 : number();
+			}
+
+			if (at_end() || peek() != '}' || (max != -1 && max < min))
+				regex_error("invalid repetition bounds");
+			++pos;
+		}
+
+		constexpr int number()
+		{
+			if (at_end() || not is_digit(peek()))
+				regex_error("expected a number");
+
+			int res = 0;
+			while (not at_end() && is_digit(peek()))
+				res = res * 10 + (str[pos++] - '0');
+			return res;
+		}
+
+		// f repeated between min and max times (max = -1 for no limit)
+		constexpr regex_fragment repeat(regex_fragment f, int min, int max)
+		{
+			const int copies = (max == -1) ? (min ? min : 1) : max;
+
+			// copy f before any transition is added to it
+			buffer<regex_fragment> parts;
+			parts.push_back(f);
+			for (int k = 1; k < copies; ++k)
+				parts.push_back( copy(f) );
+
+			const int empty = nfa.add_state();
+			regex_fragment res = { empty, empty, f.first, 0 };
+
+			for (int k = 0; k < copies; ++k)
+			{
+				const auto p = parts[k];
+
+				// every part is wrapped in its own states, so that none has more than two epsilon transitions
+				const int start = nfa.add_state(), end = nfa.add_state();
+				nfa.add_epsilon(start, p.start);
+				nfa.add_epsilon(p.end, end);
+
+				if (k >= min)
+					nfa.add_epsilon(start, end);   // optional
+				if (max == -1 && k == copies - 1)
+					nfa.add_epsilon(end, start);   // and repeated
+
+				nfa.add_epsilon(res.end, start);
+				res.end = end;
+			}
+
+			if (copies == 0)
+			{
+				// {0} : the fragment is unreachable
+				res.end = nfa.add_state();
+				nfa.add_epsilon(empty, res.end);
+			}
+
+			res.last = nfa.size();
+			return res;
+		}
+
+		// a copy of the states of f, appended to the automaton
+		constexpr regex_fragment copy(regex_fragment f)
+		{
+			const int first = nfa.size();
+			const int offset = first - f.first;
+			auto shift = [&] (int s) { return (s == -1) ? -1 : s + offset; };
+
+			for (int s = f.first; s < f.last; ++s)
+			{
+				const int n = nfa.add_state();
+				nfa.bytes[n] = nfa.bytes[s];
+				nfa.out[n]   = shift(nfa.out[s]);
+				nfa.eps1[n]  = shift(nfa.eps1[s]);
+				nfa.eps2[n]  = shift(nfa.eps2[s]);
+			}
+			return { f.start + offset, f.end + offset, first, first + (f.last - f.first) };
+		}
+
+		constexpr regex_fragment atom()
+		{
+			const int first = nfa.size();
+
+			switch (peek())
+			{
+				case '(' :
+				{
+					++pos;
+					auto res = alternation();
+					if (at_end() || peek() != ')')
+						regex_error("unbalanced parenthesis");
+					++pos;
+					return res;
+				}
+				case '*' : case '+' : case '?' : case '{' :
+					regex_error("nothing to repeat");
+					return {};
+				case '[' :
+					return bytes(first, bracket());
+				case '.' :
+				{
+					++pos;
+					byte_set b;
+					b.add(0, '\n' - 1);
+					b.add('\n' + 1, 255);
+					return bytes(first, b);
+				}
+				case '\\' :
+					++pos;
+					return bytes(first, escape());
+				default :
+				{
+					byte_set b;
+					b.add(static_cast<unsigned char>(peek()), static_cast<unsigned char>(peek()));
+					++pos;
+					return bytes(first, b);
+				}
+			}
+		}
+
+		constexpr regex_fragment bytes(int first, byte_set b)
+		{
+			const int start = nfa.add_state(), end = nfa.add_state();
+			nfa.bytes[start] = b;
+			nfa.out[start] = end;
+			return { start, end, first, end + 1 };
+		}
+
+		static constexpr byte_set set_of(bool(*pred)(char))
+		{
+			byte_set res;
+			for (int b = 0; b < 256; ++b)
+				if (pred(static_cast<char>(b))) res.add(b, b);
+			return res;
+		}
+
+		constexpr int hex_digit()
+		{
+			if (at_end())
+				regex_error("expected a hexadecimal digit");
+
+			const char c = str[pos++];
+			if (is_digit(c))            return c - '0';
+			if (is_between(c, 'a', 'f')) return c - 'a' + 10;
+			if (is_between(c, 'A', 'F')) return c - 'A' + 10;
+
+			regex_error("expected a hexadecimal digit");
+			return 0;
+		}
+
+		// after a '\\'
+		constexpr byte_set escape()
+		{
+			if (at_end())
+				regex_error("trailing backslash");
+
+			const char c = str[pos++];
+			byte_set res;
+
+			auto word = [] (char c) { return is_letter(c) || is_digit(c) || c == '_'; };
+
+			switch (c)
+			{
+				case 'd' : return set_of(is_digit);
+				case 'D' : return ~set_of(is_digit);
+				case 'w' : return set_of(word);
+				case 'W' : return ~set_of(word);
+				case 's' : return set_of(is_space);
+				case 'S' : return ~set_of(is_space);
+				case 'n' : res.add('\n', '\n'); return res;
+				case 't' : res.add('\t', '\t'); return res;
+				case 'r' : res.add('\r', '\r'); return res;
+				case 'f' : res.add('\f', '\f'); return res;
+				case 'v' : res.add('\v', '\v'); return res;
+				case 'x' :
+				{
+					int b = hex_digit() * 16;
+					b += hex_digit();
+					res.add(b, b);
+					return res;
+				}
+				default :
+					res.add(static_cast<unsigned char>(c), static_cast<unsigned char>(c));
+					return res;
+			}
+		}
+
+		// a character class, [a-z_] or [^"\\]
+		constexpr byte_set bracket()
+		{
+			++pos;
+
+			const bool negated = not at_end() && peek() == '^';
+			if (negated)
+				++pos;
+
+			byte_set res;
+			bool first = true;
+
+			while (true)
+			{
+				if (at_end())
+					regex_error("unterminated character class");
+
+				if (peek() == ']' && not first)
+					break;
+				first = false;
+
+				// a single character, or a class like \d
+				auto single = [&] (int& c) -> byte_set
+				{
+					c = -1;
+					if (peek() != '\\')
+					{
+						c = static_cast<unsigned char>(str[pos++]);
+						byte_set b;
+						b.add(c, c);
+						return b;
+					}
+
+					++pos;
+					auto b = escape();
+
+					int count = 0;
+					for (int k = 0; k < 256; ++k)
+						if (b.has(k)) { c = k; ++count; }
+
+					if (count != 1) c = -1;
+					return b;
+				};
+
+				int lo = -1;
+				auto b = single(lo);
+
+				if (lo != -1 && pos + 1 < size && peek() == '-' && str[pos + 1] != ']')
+				{
+					++pos;
+					int hi = -1;
+					single(hi);
+
+					if (hi == -1 || hi < lo)
+						regex_error("invalid range in character class");
+
+					b.add(lo, hi);
+				}
+
+				res |= b;
+			}
+			++pos;
+
+			return negated ? ~res : res;
+		}
+
+		const char* str;
+		int size;
+		int pos = 0;
+
+		public :
+
+		regex_nfa nfa;
+	};
+
+	// the states reachable from the states of set through epsilon transitions
+	constexpr void epsilon_closure(const regex_nfa& nfa, buffer<int>& set)
+	{
+		buffer<bool> in(nfa.size(), false);
+		for (std::size_t k = 0; k < set.size(); ++k)
+			in[set[k]] = true;
+
+		for (std::size_t k = 0; k < set.size(); ++k)
+		{
+			for (int e : {nfa.eps1[set[k]], nfa.eps2[set[k]]})
+			{
+				if (e != -1 && not in[e])
+				{
+					in[e] = true;
+					set.push_back(e);
+				}
+			}
+		}
+
+		// sorted, so that equal sets compare equal
+		set.clear();
+		for (std::size_t s = 0; s < nfa.size(); ++s)
+			if (in[s]) set.push_back(s);
+	}
+
+	// The subset construction. State -1 is the dead state, state 0 the starting one.
+	struct regex_dfa
+	{
+		std::size_t states = 0;
+		byte_classes<256> classes; // the classes of bytes which every state treats the same way
+		buffer<int> next;          // [state * classes.count + class]
+		buffer<bool> accepting;
+	};
+
+	// the minimal DFA, the starting state stays state 0
+	constexpr regex_dfa minimize(const regex_dfa& dfa)
+	{
+		const int classes = dfa.classes.count;
+
+		buffer<int> label;
+		for (std::size_t s = 0; s < dfa.states; ++s)
+			label.push_back(dfa.accepting[s]);
+
+		const auto block = impl::equivalent_states(dfa.states, classes, dfa.next, label);
+
+		regex_dfa res;
+		res.classes = dfa.classes;
+
+		for (std::size_t s = 0; s < dfa.states; ++s)
+		{
+			if (block[s] != int(res.states))
+				continue;
+
+			++res.states;
+			res.accepting.push_back(dfa.accepting[s]);
+
+			for (int k = 0; k < classes; ++k)
+			{
+				const auto n = dfa.next[s * classes + k];
+				res.next.push_back( (n == -1) ? -1 : block[n] );
+			}
+		}
+		return res;
+	}
+
+	template <string_lit Pattern>
+	constexpr regex_dfa build_regex_dfa()
+	{
+		regex_parser parser{Pattern.data, Pattern.size - 1};
+		const auto f = parser.parse();
+		const auto& nfa = parser.nfa;
+
+		regex_dfa res;
+
+		partition p(256);
+		buffer<int> outcome;
+		for (std::size_t n = 0; n < nfa.size(); ++n)
+		{
+			if (nfa.bytes[n].empty())
+				continue;
+
+			outcome.clear();
+			for (int b = 0; b < 256; ++b)
+				outcome.push_back(nfa.bytes[n].has(b));
+			p.refine(0, outcome);
+		}
+		res.classes = byte_classes<256>{p};
+
+		buffer<int> pool;           // the nfa states of every dfa state, back to back
+		buffer<std::size_t> first;  // where each state begins in the pool
+		first.push_back(0);
+
+		auto find_or_insert = [&] (const buffer<int>& set) -> int
+		{
+			if (set.size() == 0)
+				return -1;
+
+			for (std::size_t s = 0; s + 1 < first.size(); ++s)
+			{
+				if (first[s + 1] - first[s] != set.size())
+					continue;
+				bool same = true;
+				for (std::size_t k = 0; k < set.size() && same; ++k)
+					same = (pool[first[s] + k] == set[k]);
+				if (same)
+					return s;
+			}
+
+			for (std::size_t k = 0; k < set.size(); ++k) pool.push_back(set[k]);
+			first.push_back(pool.size());
+			return first.size() - 2;
+		};
+
+		buffer<int> set;
+		set.push_back(f.start);
+		impl::epsilon_closure(nfa, set);
+		find_or_insert(set);
+
+		for (std::size_t s = 0; s + 1 < first.size(); ++s)
+		{
+			bool accepting = false;
+			for (auto k = first[s]; k != first[s + 1]; ++k)
+				accepting = accepting || pool[k] == f.end;
+			res.accepting.push_back(accepting);
+
+			for (int c = 0; c < res.classes.count; ++c)
+			{
+				const int b = res.classes.rep[c];
+
+				set.clear();
+				for (auto k = first[s]; k != first[s + 1]; ++k)
+				{
+					const auto n = pool[k];
+					if (nfa.out[n] != -1 && nfa.bytes[n].has(b))
+						set.push_back(nfa.out[n]);
+				}
+				impl::epsilon_closure(nfa, set);
+				res.next.push_back( find_or_insert(set) );
+			}
+		}
+
+		res.states = first.size() - 1;
+		return impl::minimize(res);
+	}
+
+	template <std::size_t N, std::size_t Classes>
+	struct regex_table
+	{
+		unsigned char class_of[256];
+		short next[N * Classes];
+		bool accepting[N];
+		char lo[N], hi[N]; // the range of the characters which continue the match
+
+		constexpr int get_next(int state, char c) const {
+			return next[state * Classes + class_of[static_cast<unsigned char>(c)]];
+		}
+	};
+
+	template <string_lit Pattern>
+	constexpr auto make_regex_table()
+	{
+		constexpr auto shape = [] {
+			auto dfa = impl::build_regex_dfa<Pattern>();
+			return std::pair<std::size_t, std::size_t>{dfa.states, dfa.classes.count};
+		}();
+		const auto dfa = impl::build_regex_dfa<Pattern>();
+
+		regex_table<shape.first, shape.second> res{};
+
+		for (int b = 0; b < 256; ++b)
+			res.class_of[b] = dfa.classes.of[b];
+
+		for (std::size_t k = 0; k < shape.first * shape.second; ++k)
+			res.next[k] = dfa.next[k];
+
+		for (std::size_t s = 0; s < shape.first; ++s)
+		{
+			res.accepting[s] = dfa.accepting[s];
+
+			int lo = 128, hi = -129;
+			for (int b = 0; b < 256; ++b)
+			{
+				if (res.get_next(s, static_cast<char>(b)) != -1)
+				{
+					const int c = static_cast<char>(b);
+					lo = c < lo ? c : lo;
+					hi = c > hi ? c : hi;
+				}
+			}
+
+			res.lo[s] = (lo > hi) ? 0 : lo;
+			res.hi[s] = (lo > hi) ? 0 : hi;
+		}
+		return res;
+	}
+
+	template <string_lit Pattern>
+	inline constexpr auto regex_table_of = make_regex_table<Pattern>();
+
+} // IMPL
+
+///
+/// Regular expression matcher
+/// The pattern is compiled into a DFA at compile-time, and matched like any other matcher,
+/// in the same pass as the other cases.
+/// Supports literals, '.', character classes ([a-z_], [^"], \d \w \s and their negations),
+/// escapes (\n, \t, \x41...), groups, '|', and the repetitions * + ? {n} {n,} {n,m}.
+/// The longest match wins, as with the other matchers. A zero byte is a character as any other
+/// on a bounded input ('.' and [^a] match it), a NUL-terminated input ends before it.
+///
+template <string_lit Pattern>
+struct regex_matcher {
+
+	static constexpr int match_ = -2;
+	static constexpr int fail_  = -1;
+
+	using Self = regex_matcher;
+
+	static constexpr auto& dfa = impl::regex_table_of<Pattern>;
+	static constexpr int states = static_cast<int>( std::size(dfa.accepting) );
+
+	constexpr auto status() const {
+		switch(state_) { case match_ : return matched; case fail_ : return failed; default : return running; }
+	}
+
+	constexpr auto get_next(char C) const
+	{
+		if (state_ < 0)
+			return *this;
+
+		const int n = dfa.get_next(state_, C);
+		return Self{ (n != -1) ? n : dfa.accepting[state_] ? match_ : fail_ };
+	}
+
+	constexpr char min() const { return dfa.lo[ (state_ < 0) ? 0 : state_ ]; }
+	constexpr char max() const { return dfa.hi[ (state_ < 0) ? 0 : state_ ]; }
+
+	constexpr bool can_fail() const { return state_ < 0 || not dfa.accepting[state_]; }
+
+	// a zero byte may go on with the match, it doesn't tell whether the input read so far is accepted
+	constexpr bool accepts() const { return state_ == match_ || (state_ >= 0 && dfa.accepting[state_]); }
+
+	constexpr bool operator==(const regex_matcher&) const = default;
+
+	int state_ = 0;
+};
+
+static_assert( matcher<regex_matcher<"a|b">> );
+
+template <string_lit Pattern>
+inline constexpr auto re = regex_matcher<Pattern>{};
+
+namespace impl {
+
+	// e.g. '.' and [^a] go on with a zero byte, where a NUL-terminated input ends
+	template <string_lit Pattern>
+	inline constexpr bool reads_zero<regex_matcher<Pattern>> = [] {
+		for (int s = 0; s < regex_matcher<Pattern>::states; ++s)
+			if (regex_matcher<Pattern>::dfa.get_next(s, 0) != -1)
+				return true;
+		return false;
+	}();
+
+} // IMPL
+
+} // STRM
+
+#endif
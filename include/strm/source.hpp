@@ -0,0 +1,359 @@
+#ifndef STRM_CPP_LIBRARY_SOURCE_HEADER
+#define STRM_CPP_LIBRARY_SOURCE_HEADER
+
+#include "strm.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define STRM_POSIX_SOURCES 1
+#endif
+
+namespace strm {
+
+namespace impl {
+
+	// The end of the characters read so far : the engine compares its position with it
+	// before reading each character, so reaching it means that the match needs more input.
+	struct block_end
+	{
+		const char* end;
+		bool* reached;
+
+		friend constexpr bool operator == (const char* it, const block_end& e)
+		{
+			if (it != e.end) [[likely]]
+				return false;
+			*e.reached = true;
+			return true;
+		}
+
+		// the vectorized loops read up to the end, then compare with it
+		friend constexpr std::ptrdiff_t operator - (const block_end& e, const char* it) { return e.end - it; }
+		friend constexpr std::ptrdiff_t operator - (const char* it, const block_end& e) { return it - e.end; }
+	};
+
+} // IMPL
+
+///
+/// An input read by blocks from a std::istream, a FILE* or a file descriptor (e.g. a pipe, or stdin),
+/// matched with strm::match as if it was in memory : the engine runs on raw pointers into a buffer.
+/// The characters from the beginning of the current match are kept, so the engine can fall back
+/// to its last accepting position ; a match which needs more input than the buffer holds is run again
+/// once more is read, and the buffer grows if a single match doesn't fit in it. Each time the same
+/// match runs again, twice as much is read, so a token over N blocks is scanned O(N) times in all.
+///
+/// The lexeme given to an action (e.g. a std::string_view) points into the buffer,
+/// it is valid until the next match. A read error throws a std::system_error
+/// (a std::ios_base::failure for a stream, whose badbit is set), the input isn't cut short.
+///
+class buffered_source
+{
+	public :
+
+	static constexpr std::size_t default_block = std::size_t{1} << 16;
+
+	explicit buffered_source(std::istream& in, std::size_t block = default_block)
+	: buffered_source{ &read_stream, &in, block }
+	{}
+
+	explicit buffered_source(std::FILE* file, std::size_t block = default_block)
+	: buffered_source{ &read_file, file, block }
+	{}
+
+	#ifdef STRM_POSIX_SOURCES
+	// the descriptor isn't closed
+	explicit buffered_source(int fd, std::size_t block = default_block)
+	: buffered_source{ &read_fd, reinterpret_cast<void*>(static_cast<std::intptr_t>(fd)), block }
+	{}
+	#endif
+
+	buffered_source(const buffered_source&) = delete;
+	buffered_source& operator = (const buffered_source&) = delete;
+
+	// every character of the input was consumed
+	bool empty()
+	{
+		return pos_ == end_ && not fill(block_);
+	}
+
+	// the number of characters consumed so far
+	std::size_t offset() const { return consumed_ + (pos_ - buffer_.get()); }
+
+	// the characters read ahead, and not consumed yet
+	std::string_view buffered() const { return { pos_, static_cast<std::size_t>(end_ - pos_) }; }
+
+	// Run Automaton from the next character, and return the case that matched. If it reaches the end 
+	// of the characters read so far, it runs again once more is read, twice as much each time. 
+	// [first, last) are set to the characters it consumed.
+	template <class Automaton>
+	impl::accepted run(const char*& first, const char*& last)
+	{
+		std::size_t more = block_;
+
+		while (true)
+		{
+			const char* it = pos_;
+			bool reached = false;
+			impl::accepted acc;
+
+			if (eof_)
+				acc = Automaton::run(it, end_);
+			else
+				acc = Automaton::run(it, impl::block_end{ end_, &reached });
+
+			if (not reached)
+			{
+				first = pos_;
+				last = pos_ = it;
+				return acc;
+			}
+
+			// the buffer still holds every character since the beginning of the match
+			fill(more);
+			more *= 2;
+		}
+	}
+
+	private :
+
+	using read_fn = std::size_t (*)(void*, char*, std::size_t);
+
+	buffered_source(read_fn read, void* handle, std::size_t block)
+	: read_{read}, handle_{handle}, block_{block == 0 ? 1 : block},
+	  capacity_{block_}, buffer_{ std::make_unique<char[]>(capacity_) },
+	  pos_{buffer_.get()}, end_{buffer_.get()}
+	{}
+
+	// Errors throw, so that they don't look like the end of the input
+	static std::size_t read_stream(void* in, char* dst, std::size_t n)
+	{
+		auto& stream = *static_cast<std::istream*>(in);
+		stream.read(dst, static_cast<std::streamsize>(n));
+
+		if (stream.bad())
+			throw std::ios_base::failure{ "strm::buffered_source: read" };
+		return static_cast<std::size_t>(stream.gcount());
+	}
+
+	static std::size_t read_file(void* file, char* dst, std::size_t n)
+	{
+		const auto got = std::fread(dst, 1, n, static_cast<std::FILE*>(file));
+
+		if (got < n && std::ferror(static_cast<std::FILE*>(file)))
+			throw std::system_error{ errno ? errno : EIO, std::generic_category(), "strm::buffered_source: fread" };
+		return got;
+	}
+
+	#ifdef STRM_POSIX_SOURCES
+	static std::size_t read_fd(void* fd, char* dst, std::size_t n)
+	{
+		while (true)
+		{
+			const auto got = ::read(static_cast<int>(reinterpret_cast<std::intptr_t>(fd)), dst, n);
+			if (got >= 0)
+				return static_cast<std::size_t>(got);
+			if (errno != EINTR)
+				throw std::system_error{ errno, std::generic_category(), "strm::buffered_source: read" };
+		}
+	}
+	#endif
+
+	// Read up to n characters after those not consumed yet, which move to the front of the buffer.
+	// Returns false at the end of the input.
+	bool fill(std::size_t n)
+	{
+		if (eof_)
+			return false;
+
+		const auto kept = static_cast<std::size_t>(end_ - pos_);
+		consumed_ += pos_ - buffer_.get();
+
+		if (kept + n > capacity_)
+		{
+			// a match spans the whole buffer
+			capacity_ = std::max(capacity_ * 2, kept + n);
+			auto bigger = std::make_unique<char[]>(capacity_);
+			std::memcpy(bigger.get(), pos_, kept);
+			buffer_ = std::move(bigger);
+		}
+		else if (kept != 0 && pos_ != buffer_.get())
+		{
+			std::memmove(buffer_.get(), pos_, kept);
+		}
+
+		pos_ = buffer_.get();
+		end_ = pos_ + kept;
+
+		const auto got = read_(handle_, buffer_.get() + kept, n);
+		end_ += got;
+
+		if (got == 0)
+			eof_ = true;
+		return got != 0;
+	}
+
+	read_fn read_;
+	void* handle_;
+	std::size_t block_;
+
+	std::size_t capacity_;
+	std::unique_ptr<char[]> buffer_;
+
+	const char* pos_;
+	const char* end_;
+	std::size_t consumed_ = 0;
+	bool eof_ = false;
+};
+
+///
+/// Match the next characters of a buffered_source, which are consumed as with match on an iterator.
+/// The actions only run once the match is known, so a match retried after reading more input
+/// doesn't call them twice.
+///
+template <class... Options, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+decltype(auto) match(buffered_source& src, Default&& default_, Cases... cases)
+{
+	using automaton = impl::automaton< impl::options<Options...>, typename Cases::matcher... >;
+
+	const char* first = nullptr;
+	const char* last = nullptr;
+
+	impl::default_case default_action{ default_ };
+	auto actions = impl::tuple{ impl::bind_action<typename Cases::matcher>(cases.result, first, last)... };
+
+	using result = decltype( default_action(last) );
+
+	#ifdef STRM_COUNTERS
+	impl::match_recorder<const char*> recorder{ &impl::cases_id<typename Cases::matcher...>, first, last };
+	#endif
+
+	const auto acc = src.template run<automaton>(first, last);
+
+	STRM_COUNT( recorder.state.index = acc.index )
+
+	if (acc.index == -1)
+		return default_action(last);
+
+	return impl::invoke_case<result>(acc, actions, std::index_sequence_for<Cases...>{});
+}
+
+#ifdef STRM_POSIX_SOURCES
+///
+/// A file mapped in memory, read-only, for strm::match on a plain const char* : nothing is read
+/// up-front nor copied, the pages are read as the engine reaches them (with a sequential-access hint).
+/// The mapping is followed by at least one zero byte, also when the size of the file is a multiple
+/// of the page size (an anonymous zero page is mapped after it), so data() is NUL-terminated.
+/// Files which may contain zero bytes are matched on view() instead.
+///
+/// The file must not shrink while it is mapped, reading past its new end is a SIGBUS.
+/// Errors (opening, mapping) throw a std::system_error.
+///
+class mapped_source
+{
+	public :
+
+	explicit mapped_source(const char* path)
+	{
+		const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+		if (fd == -1)
+			throw std::system_error{ errno, std::generic_category(), "strm::mapped_source: open" };
+
+		try
+		{
+			map(fd);
+		}
+		catch (...)
+		{
+			::close(fd);
+			throw;
+		}
+		::close(fd);
+	}
+
+	// the descriptor isn't closed, the mapping doesn't need it
+	explicit mapped_source(int fd)
+	{
+		map(fd);
+	}
+
+	mapped_source(mapped_source&& other) noexcept
+	: data_{ std::exchange(other.data_, nullptr) }, size_{other.size_}, length_{other.length_}
+	{}
+
+	mapped_source& operator = (mapped_source&& other) noexcept
+	{
+		std::swap(data_, other.data_);
+		std::swap(size_, other.size_);
+		std::swap(length_, other.length_);
+		return *this;
+	}
+
+	~mapped_source()
+	{
+		if (data_)
+			::munmap(const_cast<char*>(data_), length_);
+	}
+
+	// the characters of the file, followed by a zero
+	const char* data() const { return data_; }
+	std::size_t size() const { return size_; }
+
+	std::string_view view() const { return { data_, size_ }; }
+
+	private :
+
+	void map(int fd)
+	{
+		struct stat st;
+		if (::fstat(fd, &st) == -1)
+			throw std::system_error{ errno, std::generic_category(), "strm::mapped_source: fstat" };
+
+		const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+		size_ = static_cast<std::size_t>(st.st_size);
+		length_ = (size_ / page + 1) * page;
+
+		// the whole range is reserved with zero pages, then the file is mapped over its beginning :
+		// the end of its last page reads as zeros, and so does the page after it
+		void* base = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (base == MAP_FAILED)
+			throw std::system_error{ errno, std::generic_category(), "strm::mapped_source: mmap" };
+
+		if (size_ != 0 && ::mmap(base, size_, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+		{
+			const int error = errno;
+			::munmap(base, length_);
+			throw std::system_error{ error, std::generic_category(), "strm::mapped_source: mmap" };
+		}
+
+		// only a hint, it may fail
+		if (size_ != 0)
+			::posix_madvise(base, size_, POSIX_MADV_SEQUENTIAL);
+
+		data_ = static_cast<const char*>(base);
+	}
+
+	const char* data_ = nullptr;
+	std::size_t size_ = 0;
+	std::size_t length_ = 0;
+};
+#endif
+
+} // STRM
+
+#undef STRM_POSIX_SOURCES
+
+#endif
@@ -2,9 +2,31 @@
 #define STRM_CPP_LIBRARY_HEADER
 
 #include <utility>
+#include <type_traits>
+#include <iterator>
+#include <string_view>
+#include <bit>
+#include <span>
+#include <optional>
+#include <cstdint>
+#include <charconv>
+#include <limits>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 #define STRM_FWD(X) static_cast<decltype(X)&&>(X)
 
+// With STRM_COUNTERS defined (for the whole program), the matches report what they did to a counter_sink 
+// (see counter_sink for the functions which are counted). Otherwise the counters compile down to nothing.
+#ifdef STRM_COUNTERS
+	#define STRM_COUNT(...) if (not std::is_constant_evaluated()) { __VA_ARGS__; }
+#else
+	#define STRM_COUNT(...)
+#endif
+
 namespace strm {
 
 // ====================================================================
@@ -55,6 +77,10 @@ constexpr bool is_digit(char c) {
 	return is_between(c, '0', '9'); 
 }
 
+constexpr bool is_space(char c) {
+	return c == ' ' or is_between(c, '\t', '\r');
+}
+
 // ==============================================================
 // matchers
 
@@ -102,6 +128,8 @@ struct string_matcher {
 	
 	constexpr bool can_fail() const { return true;           }
 	
+	constexpr bool operator==(const string_matcher&) const = default;
+	
 	int index = 0;
 };
 
@@ -112,6 +140,77 @@ inline constexpr auto lit = string_matcher<Str>{};
 static_assert( matcher<decltype(lit<"test">)> );
 
 
+namespace impl {
+	
+	constexpr char to_lower(char c) {
+		return is_between(c, 'A', 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+	}
+	
+	constexpr char to_upper(char c) {
+		return is_between(c, 'a', 'z') ? static_cast<char>(c - 'a' + 'A') : c;
+	}
+	
+	template <int N>
+	constexpr string_lit<N> fold_case(string_lit<N> str)
+	{
+		for (auto& c : str.data) c = to_lower(c);
+		return str;
+	}
+	
+} // IMPL
+
+///
+/// Case-insensitive string matcher, for ASCII letters
+/// The string is folded at compile-time, and both cases of a letter continue the match.
+///
+template <auto str>
+struct istring_matcher {
+
+	static constexpr auto size = str.size - 1;
+	static constexpr auto folded = impl::fold_case(str);
+	
+	constexpr auto get_next(char C) const 
+	{
+		if ( index >= size || index == -2 )
+			return istring_matcher{-2};
+		
+		if ( index == -1 )
+			return *this;
+		
+		if (folded.data[index] == impl::to_lower(C)) 
+			return istring_matcher{index + 1};
+		else
+			return istring_matcher{-1};
+	}
+	
+	constexpr auto status() const {
+		switch(index) {
+			case -2 : return matched;
+			case -1 : return failed;
+			default : return running;
+		}
+	}
+	
+	// the upper case letters come first
+	constexpr char min() const { return impl::to_upper( current() ); }
+	constexpr char max() const { return current(); }
+	
+	constexpr bool can_fail() const { return true; }
+	
+	constexpr bool operator==(const istring_matcher&) const = default;
+	
+	int index = 0;
+	
+	private : 
+	
+	constexpr char current() const { return folded.data[ (index < 0 || index >= size) ? 0 : index ]; }
+};
+
+template <string_lit Str>
+inline constexpr auto ilit = istring_matcher<Str>{};
+
+static_assert( matcher<decltype(ilit<"test">)> );
+
 #define STRM_MATCHER_BASE() \
 	static constexpr char match_ = -2; \
 	static constexpr char fail_  = -1; \
@@ -151,6 +250,8 @@ struct float_matcher {
 		}
 	}
 	
+	constexpr bool operator==(const float_matcher&) const = default;
+	
 	char state_ = 0;
 };
 
@@ -186,6 +287,8 @@ struct identifier_matcher {
 			: Self{match_};
 	}
 	
+	constexpr bool operator==(const identifier_matcher&) const = default;
+	
 	char state_ = 0;
 };
 
@@ -214,6 +317,8 @@ struct integer_matcher {
 	constexpr char min() const { return '0'; }
 	constexpr char max() const { return '9'; }
 	
+	constexpr bool operator==(const integer_matcher&) const = default;
+	
 	char state_ = 0;
 };
 
@@ -221,375 +326,3528 @@ static_assert( matcher<integer_matcher> );
 
 inline constexpr integer_matcher int_num;
 
-#undef STRM_MATCHER_BASE
-
 ///
-/// Utility wrapper to bind a matcher to a result
+/// A number parsed by a value matcher, saturated if it overflows T
 ///
-template <matcher Matcher, class Result>
-struct case_
+template <class T>
+struct number
 {
-	case_(Matcher, Result r) : result{static_cast<Result&&>(r)} {}
+	T value = {};
+	bool overflow = false;
 	
-	using matcher = Matcher;
-	Result result;
+	constexpr bool operator==(const number&) const = default;
 };
 
-template <matcher Matcher, class Result>
-constexpr auto operator >> (Matcher m, Result r)
-{
-	return case_<Matcher, Result>{ m, r };
-}
-
 namespace impl {
 	
-	// ====================================================================
-	// a simple tuple to store actions
+	template <class Iterator>
+	concept contiguous_chars = std::contiguous_iterator<Iterator> && std::is_same_v<std::iter_value_t<Iterator>, char>;
 	
-	template <std::size_t Idx, class T>
-	struct tuple_leaf { T value; };
+	// exact powers of ten as doubles
+	inline constexpr double pow10[] = {
+		1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11, 
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
 	
-	template <std::size_t Idx, class T>
-	constexpr auto& get(tuple_leaf<Idx, T>& l) { return l.value; }
-
-	template <class Seq, class...>
-	struct tuple_data;
+} // IMPL
 
-	template <std::size_t... Idx, class... Ts>
-	struct tuple_data<std::index_sequence<Idx...>, Ts...> : tuple_leaf<Idx, Ts>... {};
+///
+/// Integer matcher which also computes the value of the integer. 
+/// An action which takes a number<T> receives it.
+///
+template <class T = long long>
+struct int_value_matcher : integer_matcher 
+{
+	static_assert( std::is_integral_v<T> );
 	
-	template <class... Ts>
-	struct tuple : tuple_data<std::make_index_sequence<sizeof...(Ts)>, Ts...> {};
+	constexpr int_value_matcher get_next(char C) const { return { integer_matcher::get_next(C) }; }
+	
+	template <class Iterator>
+	static constexpr number<T> value(Iterator first, Iterator last)
+	{
+		constexpr T limit = std::numeric_limits<T>::max();
+		
+		number<T> res;
+		
+		for (; first != last; ++first)
+		{
+			const T digit = *first - '0';
+			
+			if (res.value > (limit - digit) / 10)
+				return { limit, true };
+			
+			res.value = res.value * 10 + digit;
+		}
+		return res;
+	}
+};
 
-	template <class... Ts>
-	tuple(Ts...) -> tuple<Ts...>;
+static_assert( matcher<int_value_matcher<>> );
+
+template <class T = long long>
+inline constexpr int_value_matcher<T> int_value;
+
+///
+/// Floating point matcher which also computes the value of the number. 
+/// An action which takes a number<T> receives it.
+///
+template <class T = double>
+struct float_value_matcher : float_matcher 
+{
+	static_assert( std::is_floating_point_v<T> );
 	
-	// ====================================================================
+	constexpr float_value_matcher get_next(char C) const { return { float_matcher::get_next(C) }; }
 	
-	template <class Result, class Iterator>
-	struct fallback
+	template <class Iterator>
+	static number<T> value(Iterator first, Iterator last)
 	{
-		constexpr decltype(auto) operator()(Iterator& dest) 
+		// the first 19 significant digits, and the power of ten they're multiplied by
+		std::uint64_t mantissa = 0;
+		int digits = 0;
+		int exponent = 0;
+		bool fraction = false;
+		
+		for (auto it = first; it != last; ++it)
 		{
-			dest = saved_iterator;
-			if constexpr ( requires {result();} )
-				return result();
+			if (*it == '.')
+			{
+				fraction = true;
+				continue;
+			}
+			
+			if (digits < 19)
+			{
+				if (mantissa != 0 || *it != '0')
+					++digits;
+				
+				mantissa = mantissa * 10 + (*it - '0');
+				exponent -= fraction;
+			}
 			else
-				return result;
+				exponent += not fraction;
 		}
 		
-		Result result;
-		Iterator saved_iterator;
-	};
-	
-	template <class R, class I>
-	fallback(R, I) -> fallback<R, I>;
-	
-	template <class Action>
-	struct default_case 
-	{ 
-		constexpr decltype(auto) operator()(auto)
+		// the exact case : both the mantissa and the power of ten are exact doubles
+		if constexpr ( std::is_same_v<T, double> )
 		{
-			if constexpr ( requires { action(); } )
-				return action();
-			else
-				return action;
+			if (mantissa <= (std::uint64_t{1} << 53) && exponent >= -22 && exponent <= 22)
+			{
+				const auto m = static_cast<double>(mantissa);
+				return { exponent < 0 ? m / impl::pow10[-exponent] : m * impl::pow10[exponent] };
+			}
 		}
 		
-		Action action;
-	};
-	
-	template <class A>
-	default_case(A) -> default_case<A>;
+		number<T> res;
+		std::from_chars_result r;
+		
+		if constexpr ( impl::contiguous_chars<Iterator> )
+		{
+			r = std::from_chars(std::to_address(first), std::to_address(last), res.value);
+		}
+		else
+		{
+			// beyond 19 digits, the rest only matters in a few halfway cases
+			char buf[32];
+			auto end = std::to_chars(buf, buf + 20, mantissa).ptr;
+			*end++ = 'e';
+			end = std::to_chars(end, buf + sizeof(buf), exponent).ptr;
+			r = std::from_chars(buf, end, res.value);
+		}
+		
+		if (r.ec == std::errc::result_out_of_range)
+			return (digits + exponent < 0) ? number<T>{ 0 } : number<T>{ std::numeric_limits<T>::max(), true };
+		
+		return res;
+	}
+};
+
+static_assert( matcher<float_value_matcher<>> );
+
+template <class T = double>
+inline constexpr float_value_matcher<T> float_value;
+
+/// 
+/// Whitespace matcher
+/// Match a sequence of spaces, tabs and line breaks
+///
+struct whitespace_matcher {
 	
-	// ====================================================================
+	STRM_MATCHER_BASE()
 	
-	template <int A, class... Ts>
-	struct matcher_list;
+	using Self = whitespace_matcher;
 	
-	// traverse the status array and pick the matchers
-	template <char Pick, bool LookForMatch>
-	struct make_next_list 
+	constexpr auto get_next(char C) const 
 	{
-		template <int Clk, auto Data, class Head, class... Tail> 
-		using f = typename make_next_list< Head::matcher.status(), LookForMatch >
-			::template f<(Clk - 1), Data, Head, Tail...>;
-	};
+		return is_space(C) ? Self{1} 
+				           : ((state_ == 0) ? Self{fail_} : Self{match_});
+	}
 	
-	// -2 : pick
-	// -1 : stop
-	// 0 : matcher is running, keep it
-	// 1 : matcher successful, update state and toss it
-	// 2 : matcher failed, toss it
+	constexpr bool can_fail() const { return state_ == 0; }
 	
-	template <bool B>
-	struct make_next_list<-1, B> 
+	constexpr char min() const { return '\t'; }
+	constexpr char max() const { return ' '; }
+	
+	constexpr bool operator==(const whitespace_matcher&) const = default;
+	
+	char state_ = 0;
+};
+
+static_assert( matcher<whitespace_matcher> );
+
+inline constexpr whitespace_matcher whitespace;
+
+namespace impl {
+	
+	struct trie_node
 	{
-		template <int, auto Data, class... Ts>
-		using f = matcher_list< Data, Ts... >;
+		char c = 0;
+		int child = -1;   // the first child
+		int sibling = -1; // the next child of the parent
+		int keyword = -1; // the keyword which ends here, if any
+		char lo = 0, hi = 0; // the range of the characters of the children
 	};
 	
-	template <bool B>
-	struct make_next_list<0, B> 
+	template <std::size_t N>
+	struct trie
 	{
-		template <int Clk, auto Data, class Head, class... Tail>
-		using f = typename make_next_list< (Clk == 0 ? -1 : -2), B >
-			::template f<Clk, Data, Tail..., Head>;
+		trie_node nodes[N];
+		int size = 1;
 	};
 	
-	// Found a "matched" status, filter it out and update the CurrentActionIndex
-	template <>
-	struct make_next_list<1, true>
+	// a trie of the keywords, the root is node 0
+	template <string_lit... Strs>
+	constexpr auto make_trie()
 	{
-		template <int Clk, auto Data, class Head, class... Tail>
-		using f = typename make_next_list< (Clk == 0 ? -1 : -2), false>
-			::template f<Clk, Head::index, Tail...>;
-	};
+		trie<(1 + ... + (Strs.size - 1))> res{};
+		int keyword = 0;
+		
+		auto insert = [&] (const auto& str)
+		{
+			int n = 0;
+			for (int k = 0; k + 1 < str.size; ++k)
+			{
+				int c = res.nodes[n].child;
+				while (c != -1 && res.nodes[c].c != str.data[k])
+					c = res.nodes[c].sibling;
+				
+				if (c == -1)
+				{
+					c = res.size++;
+					res.nodes[c].c = str.data[k];
+					res.nodes[c].sibling = res.nodes[n].child;
+					res.nodes[n].child = c;
+				}
+				n = c;
+			}
+			
+			// the first of duplicated keywords has priority
+			if (res.nodes[n].keyword == -1)
+				res.nodes[n].keyword = keyword;
+			++keyword;
+		};
+		
+		(insert(Strs), ...);
+		
+		for (int n = 0; n < res.size; ++n)
+		{
+			auto& node = res.nodes[n];
+			int c = node.child;
+			node.lo = node.hi = (c == -1) ? 0 : res.nodes[c].c;
+			
+			for (; c != -1; c = res.nodes[c].sibling)
+			{
+				node.lo = res.nodes[c].c < node.lo ? res.nodes[c].c : node.lo;
+				node.hi = res.nodes[c].c > node.hi ? res.nodes[c].c : node.hi;
+			}
+		}
+		return res;
+	}
 	
-	// Found a "matched" but we don't care cause we already found a "matched" in this row
-	template <>
-	struct make_next_list<1, false>
+	
+	// 64-bit finalizer of murmur3
+	constexpr std::uint64_t mix(std::uint64_t h)
 	{
-		template <int Clk, auto Data, class Head, class... Tail>
-		using f = typename make_next_list< (Clk == 0 ? -1 : -2), false>
-			::template f<Clk, Data, Tail...>;
-	};
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ull;
+		h ^= h >> 33;
+		return h;
+	}
 	
-	// Filter out the matcher
-	template <bool B>
-	struct make_next_list<2, B> 
-	{	
-		template <int Clk, auto Data, class Head, class... Tail>
-		using f = typename make_next_list< (Clk == 0 ? -1 : -2), B >
-			::template f<Clk, Data, Tail...>;
-	};
+	template <class It>
+	constexpr std::uint64_t hash_span(It first, It last)
+	{
+		std::uint64_t h = 14695981039346656037ull;
+		for (; first != last; ++first)
+			h = (h ^ static_cast<unsigned char>(*first)) * 1099511628211ull;
+		return h;
+	}
 	
-	template <auto Data, class... Cases>
-	using make_next_list_t =
-	typename make_next_list<-2, (sizeof...(Cases) < 100000000000000)> // trick the compiler into deferring the alias
-		::template f
-		<sizeof...(Cases), 
-		 Data, 
-		 Cases...
-		>;
+	///
+	/// A perfect hash of the keywords (hash and displace) : the hash of a string picks a bucket, 
+	/// and the displacement of the bucket a slot, where only one keyword can be.
+	///
+	template <std::size_t N, std::size_t Chars>
+	struct perfect_hash
+	{
+		static constexpr std::size_t slots   = std::bit_ceil(N) * 2;
+		static constexpr std::size_t buckets = (N + 3) / 4 ? std::bit_ceil((N + 3) / 4) : 1;
 		
-	// ====================================================================
-	
-	template <int ActionIdx, class... Cases>
-	struct matcher_list
-	{	
-		static constexpr auto action_index = ActionIdx;
+		static constexpr std::size_t slot_of(std::uint64_t h, std::uint32_t displacement) {
+			return impl::mix(h + displacement * 0x9e3779b97f4a7c15ull) & (slots - 1);
+		}
 		
-		static constexpr bool failed = false;
-		static constexpr auto min = strm::min({static_cast<char>(Cases::matcher.min())...});
-		static constexpr auto max = strm::max({static_cast<char>(Cases::matcher.max())...});
-		static constexpr bool can_fail = (Cases::matcher.can_fail() && ...);
+		// the index of the keyword [first, last), -1 if it isn't one
+		template <class It>
+		constexpr int find(It first, It last) const
+		{
+			const auto h = impl::hash_span(first, last);
+			const int k = keyword[ slot_of(h, displacement[h & (buckets - 1)]) ];
+			
+			if (k == -1)
+				return -1;
+			
+			auto c = text + offset[k];
+			for (; first != last; ++first, ++c)
+			{
+				if (c == text + offset[k + 1] || *c != *first)
+					return -1;
+			}
+			return (c == text + offset[k + 1]) ? k : -1;
+		}
 		
-		template <char C> 
-		using get_next = make_next_list_t<ActionIdx, typename Cases::template get_next<C>...>;
+		char text[Chars] {};                  // the keywords, back to back
+		std::uint32_t offset[N + 1] {};       // where each keyword begins in text
+		std::uint32_t displacement[buckets] {};
+		short keyword[slots] {};              // the keyword in each slot, -1 if none
 	};
 	
-	template <int ActionIdx>
-	struct matcher_list<ActionIdx>
+	template <string_lit... Strs>
+	constexpr auto make_perfect_hash()
 	{
-		static constexpr auto action_index = ActionIdx;
-		static constexpr bool failed = true;
-	};
-	
-	template <class... Ts>
-	matcher_list(Ts...) -> matcher_list<-1, Ts...>;
-	
-	template <auto M, std::size_t Idx>
-	struct w_index {
-		static constexpr auto index = Idx;
-		static constexpr auto matcher = M;
+		constexpr auto N = sizeof...(Strs);
+		using result = perfect_hash<N, (1 + ... + (Strs.size - 1))>;
+		result res{};
 		
-		template <char C>
-		using get_next = w_index<M.get_next(C), Idx>;
-	};
+		std::size_t idx = 0;
+		auto append = [&] (const auto& str) 
+		{
+			res.offset[idx + 1] = res.offset[idx] + (str.size - 1);
+			for (int j = 0; j + 1 < str.size; ++j)
+				res.text[ res.offset[idx] + j ] = str.data[j];
+			++idx;
+		};
+		(append(Strs), ...);
+		
+		std::uint64_t hash[N + 1] {};
+		int order[N + 1] {};   // the keywords sorted by bucket, biggest buckets first
+		int size[result::buckets] {};
+		std::size_t count = 0;
+		
+		for (std::size_t k = 0; k < result::slots; ++k)
+			res.keyword[k] = -1;
+		
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			hash[k] = impl::hash_span(res.text + res.offset[k], res.text + res.offset[k + 1]);
+			
+			// the first of duplicated keywords has priority
+			bool dup = false;
+			for (std::size_t j = 0; j < k && not dup; ++j)
+			{
+				dup = hash[j] == hash[k] 
+					&& std::string_view(res.text + res.offset[j], res.offset[j + 1] - res.offset[j]) 
+					== std::string_view(res.text + res.offset[k], res.offset[k + 1] - res.offset[k]);
+			}
+			
+			if (not dup)
+			{
+				order[count++] = k;
+				++size[ hash[k] & (result::buckets - 1) ];
+			}
+		}
+		
+		for (std::size_t i = 1; i < count; ++i)
+		{
+			for (std::size_t j = i; j > 0; --j)
+			{
+				auto a = hash[order[j - 1]] & (result::buckets - 1);
+				auto b = hash[order[j]] & (result::buckets - 1);
+				if (size[a] > size[b] || (size[a] == size[b] && a <= b))
+					break;
+				std::swap(order[j - 1], order[j]);
+			}
+		}
+		
+		for (std::size_t i = 0; i < count; )
+		{
+			const auto b = hash[order[i]] & (result::buckets - 1);
+			const std::size_t n = size[b];
+			
+			for (std::uint32_t d = 0;; ++d)
+			{
+				bool free = true;
+				for (std::size_t j = 0; j < n && free; ++j)
+				{
+					auto s = result::slot_of(hash[order[i + j]], d);
+					free = res.keyword[s] == -1;
+					for (std::size_t l = 0; l < j && free; ++l)
+						free = s != result::slot_of(hash[order[i + l]], d);
+				}
+				
+				if (free)
+				{
+					res.displacement[b] = d;
+					for (std::size_t j = 0; j < n; ++j)
+						res.keyword[ result::slot_of(hash[order[i + j]], d) ] = order[i + j];
+					break;
+				}
+			}
+			i += n;
+		}
+		
+		return res;
+	}
 	
-	template <class Seq>
-	struct make_list_impl;
+} // IMPL
+
+///
+/// A set of literals, for the keywords matcher. 
+/// A type deriving from it names the set : the name of a keyword set appears in the type of 
+/// every state of its automaton, and a long list of literals makes them very slow to compile.
+///
+/// struct sql_keywords : strm::keyword_set<"select", "from", "where"> {};
+///
+template <string_lit... Strs>
+struct keyword_set {
+	static constexpr auto trie = impl::make_trie<Strs...>();
+	static constexpr auto hash = impl::make_perfect_hash<Strs...>();
+};
+
+///
+/// Keywords matcher
+/// Match any literal of a keyword_set, with the longest one winning. 
+/// The literals share a trie, which is much cheaper to compile than a lit case for each of them. 
+/// alternative() is the index of the literal which matches if the input stops here, 
+/// the result of the case may take it as a parameter.
+///
+template <class Set>
+struct keywords_matcher {
 	
-	template <std::size_t... Idx>
-	struct make_list_impl<std::index_sequence<Idx...>> {
+	STRM_MATCHER_BASE()
 	
-		template <class... Ts>
-		using f = matcher_list<-1, w_index<Ts{}, Idx>...>;
+	using Self = keywords_matcher;
+	
+	static constexpr auto& trie = Set::trie;
+	
+	constexpr auto get_next(char C) const 
+	{
+		if (state_ < 0)
+			return *this;
+		
+		for (int c = trie.nodes[state_].child; c != -1; c = trie.nodes[c].sibling)
+			if (trie.nodes[c].c == C)
+				return Self{c};
+		
+		return Self{ (trie.nodes[state_].keyword != -1) ? match_ : fail_ };
+	}
+	
+	// the characters which continue a keyword from here
+	constexpr char min() const { return trie.nodes[ (state_ < 0) ? 0 : state_ ].lo; }
+	constexpr char max() const { return trie.nodes[ (state_ < 0) ? 0 : state_ ].hi; }
+	
+	constexpr bool can_fail() const { return state_ < 0 || trie.nodes[state_].keyword == -1; }
+	
+	constexpr int alternative() const { return (state_ < 0) ? -1 : trie.nodes[state_].keyword; }
+	
+	constexpr bool operator==(const keywords_matcher&) const = default;
+	
+	int state_ = 0;
+};
+
+static_assert( matcher<keywords_matcher<keyword_set<"a", "b">>> );
+
+// user-side helpers, for a named keyword_set, or a short list of literals
+template <class Set>
+inline constexpr auto keywords_of = keywords_matcher<Set>{};
+
+template <string_lit... Strs>
+inline constexpr auto keywords = keywords_matcher<keyword_set<Strs...>>{};
+
+///
+/// An identifier, classified with a perfect hash of a keyword_set once it is matched. 
+/// The automaton is the one of an identifier whatever the number of keywords, 
+/// the result of the case may take the index of the keyword as a parameter (-1 for a plain identifier).
+///
+template <class Set>
+struct keyword_identifier_matcher {
+	
+	using Self = keyword_identifier_matcher;
+	
+	constexpr auto get_next(char C) const { return Self{ id.get_next(C) }; }
+	
+	constexpr auto status() const { return id.status(); }
+	constexpr char min() const { return id.min(); }
+	constexpr char max() const { return id.max(); }
+	constexpr bool can_fail() const { return id.can_fail(); }
+	
+	// the alternative of the input [first, last) which was matched
+	template <class It>
+	static constexpr int classify(It first, It last) { return Set::hash.find(first, last); }
+	
+	constexpr bool operator==(const keyword_identifier_matcher&) const = default;
+	
+	identifier_matcher id;
+};
+
+static_assert( matcher<keyword_identifier_matcher<keyword_set<"a", "b">>> );
+
+template <class Set>
+inline constexpr auto identifier_of = keyword_identifier_matcher<Set>{};
+
+#undef STRM_MATCHER_BASE
+
+///
+/// Backends, passed as options to match : 
+/// - switch_backend (default) : every state of the automaton is a function with a switch over the next character
+/// - table_backend : the automaton is flattened into a transition table, walked in a loop
+///
+struct switch_backend {};
+struct table_backend {};
+
+///
+/// Option : the flattened automaton (table backend, tokenizer, resumable matcher) is minimized. 
+/// It takes longer to compile, and shrinks the table when several paths lead to the same outcomes.
+///
+struct minimize_states {};
+
+///
+/// Match policies, passed as options to match : 
+/// - longest_match (default) : the longest match wins, the input is read until no case can match further, 
+///   then rewound to the end of the last match
+/// - first_accept : the first case to accept ends the match, so the input is never rewound
+///
+struct longest_match {};
+struct first_accept {};
+
+///
+/// Option of find_all : every position where a case matches is reported, 
+/// instead of resuming the search at the end of each match
+///
+struct overlapping {};
+
+///
+/// How often each byte shows up in the input, e.g. counted over a sample with weights_of
+///
+struct byte_weights
+{
+	unsigned weight[256] {};
+};
+
+constexpr byte_weights weights_of(std::string_view sample)
+{
+	byte_weights res;
+	for (char c : sample)
+		++res.weight[static_cast<unsigned char>(c)];
+	return res;
+}
+
+///
+/// Option of the switch backend : the ranges of characters which are frequent enough in the input
+/// are tested before the switch of each state, the most frequent first :
+/// strm::match< strm::byte_profile<strm::weights_of("some typical input")> >(src, ...)
+///
+template <byte_weights Weights>
+struct byte_profile
+{
+	static constexpr const byte_weights& weights = Weights;
+};
+
+///
+/// What a match did, reported to the counter_sink when STRM_COUNTERS is defined
+///
+struct match_event
+{
+	const void* cases;     // identifies the set of cases, the same for every match over them
+	int index;             // the case which matched, -1 for the default
+	std::size_t length;    // the characters consumed
+	std::size_t backtrack; // the characters read past the end of the match, which the input was rewound over
+};
+
+///
+/// Receives the match_event of every match, from any thread : of match and match_span, 
+/// of a tokenizer (also in parallel_tokenize, including the tokens lexed speculatively, and the skipped ones, 
+/// whose index is the number of cases), of search and find_all (the matches found), match_batch, 
+/// match on a buffered_source, and a resumable_matcher. A match on a lookahead_input isn't counted.
+///
+struct counter_sink
+{
+	virtual void record(const match_event& e) = 0;
+	
+	protected :
+	
+	~counter_sink() = default;
+};
+
+namespace impl {
+	
+	inline counter_sink* sink = nullptr;
+	
+	// what the match running on this thread did, filled in on the way. 
+	// An action may run a match of its own, which has its own probe.
+	struct match_probe
+	{
+		int index = -1;
+		std::size_t backtrack = 0;
 	};
 	
-	template <std::size_t Sz>
-	using make_seq = std::make_index_sequence<Sz>;
+	inline thread_local match_probe* probe = nullptr;
+	
+	template <class Iter>
+	constexpr std::size_t count_between(const Iter& first, const Iter& last)
+	{
+		if constexpr ( std::forward_iterator<Iter> )
+			return static_cast<std::size_t>( std::distance(first, last) );
+		else
+			return 0;
+	}
+	
+} // IMPL
+
+///
+/// Set the sink of the counters (nullptr for none). Without STRM_COUNTERS, nothing is ever reported.
+///
+inline void set_counter_sink(counter_sink* sink) {
+	impl::sink = sink;
+}
+
+///
+/// Utility wrapper to bind a matcher to a result
+///
+template <matcher Matcher, class Result>
+struct case_
+{
+	case_(Matcher, Result r) : result{static_cast<Result&&>(r)} {}
+	
+	using matcher = Matcher;
+	Result result;
+};
+
+template <matcher Matcher, class Result>
+constexpr auto operator >> (Matcher m, Result r)
+{
+	return case_<Matcher, Result>{ m, r };
+}
+
+namespace impl {
+	
+	// ====================================================================
+	// a simple tuple to store actions
+	
+	template <std::size_t Idx, class T>
+	struct tuple_leaf { T value; };
+	
+	template <std::size_t Idx, class T>
+	constexpr auto& get(tuple_leaf<Idx, T>& l) { return l.value; }
+
+	template <class Seq, class...>
+	struct tuple_data;
+
+	template <std::size_t... Idx, class... Ts>
+	struct tuple_data<std::index_sequence<Idx...>, Ts...> : tuple_leaf<Idx, Ts>... {};
 	
 	template <class... Ts>
-	using make_matchers_list = typename make_list_impl< make_seq<sizeof...(Ts)> >::
-		template f <Ts...>;
+	struct tuple : tuple_data<std::make_index_sequence<sizeof...(Ts)>, Ts...> {};
 
-	#define REP5(N) M(N) M(N + 1) M(N + 2) M(N + 3) M(N + 4)
-	#define REP10(N) REP5(N) REP5(N + 5)
-	#define REP15(N) REP10(N) REP5(N + 10)
-	#define REP30(N) REP10(N) REP10(N + 10) REP10(N + 20)
-	#define REP50(N) REP10(N) REP10(N + 10) REP10(N + 20) REP10(N + 30) REP10(N + 40)
-	#define REP100(N) REP50(N) REP50(N + 50)
-	#define REP255(N) REP100(N) REP100(N + 100) REP50(N + 200) REP5(N + 250)
+	template <class... Ts>
+	tuple(Ts...) -> tuple<Ts...>;
 	
-	// ==================================================================
-	// match impl
+	// ====================================================================
+	// constexpr utilities
 	
-	template <class Next, class Prev>
-	decltype(auto) match_impl_tail(auto& src, auto&& current, auto&& actions)
+	// a minimal growable array, usable in constant expressions
+	template <class T>
+	struct buffer
 	{
-		if constexpr ( Next::action_index != Prev::action_index && Next::can_fail )
+		constexpr buffer() = default;
+		
+		constexpr buffer(std::size_t n, T v = T{}) {
+			for (std::size_t k = 0; k < n; ++k) push_back(v);
+		}
+		
+		constexpr buffer(buffer&& o) 
+		: data_{o.data_}, size_{o.size_}, capacity_{o.capacity_}
 		{
-			auto&& next_current = impl::fallback{impl::get<Next::action_index>(actions), src};
-			return match_impl<Next>( src, STRM_FWD(next_current), STRM_FWD(actions) );
+			o.data_ = nullptr;
+			o.size_ = o.capacity_ = 0;
 		}
-		return match_impl<Next>( src, STRM_FWD(current), STRM_FWD(actions) );
-	}
-
-	template <class List, class Src>
-	auto match_impl(Src& src, auto&& current_action, auto&& actions) -> decltype( current_action(src) )
-	{
-		constexpr auto min = List::min;
-		constexpr auto max = List::max;
-	
-		#define IMPL(N) \
-			using NextList = typename List::template get_next<N>; \
-			if constexpr ( not NextList::failed ) \
-			{ \
-				++src; \
-				return impl::match_impl_tail<NextList, List>(src, STRM_FWD(current_action), STRM_FWD(actions)); \
-			} 
 		
-		#define M(N) case N : { \
-			 \
-			if constexpr (N >= min && N <= max) \
-			{ \
-				IMPL(N) \
-			} \
-			break; \
-		} \
+		constexpr buffer& operator=(buffer&& o)
+		{
+			std::swap(data_, o.data_);
+			std::swap(size_, o.size_);
+			std::swap(capacity_, o.capacity_);
+			return *this;
+		}
+		
+		constexpr ~buffer() { delete[] data_; }
+		
+		constexpr void push_back(T v)
+		{
+			if (size_ == capacity_)
+			{
+				capacity_ = capacity_ ? capacity_ * 2 : 16;
+				auto new_data = new T[capacity_];
+				for (std::size_t k = 0; k < size_; ++k) new_data[k] = data_[k];
+				delete[] data_;
+				data_ = new_data;
+			}
+			data_[size_++] = v;
+		}
+		
+		constexpr T& operator[](std::size_t k) { return data_[k]; }
+		constexpr const T& operator[](std::size_t k) const { return data_[k]; }
+		
+		constexpr std::size_t size() const { return size_; }
+		
+		constexpr void clear() { size_ = 0; }
+		
+		T* data_ = nullptr;
+		std::size_t size_ = 0;
+		std::size_t capacity_ = 0;
+	};
 	
-		constexpr auto Range = max - min;
+	// matchers are structural types, so if one doesn't provide an operator== 
+	// we can fallback to comparing its bytes
+	template <class M>
+	constexpr bool same_state(const M& a, const M& b)
+	{
+		if constexpr ( requires { bool(a == b); } )
+			return a == b;
+		else
+		{
+			struct bytes { unsigned char data[sizeof(M)]; };
+			auto x = std::bit_cast<bytes>(a);
+			auto y = std::bit_cast<bytes>(b);
+			for (std::size_t k = 0; k < sizeof(M); ++k)
+				if (x.data[k] != y.data[k]) return false;
+			return true;
+		}
+	}
 	
-		if constexpr (Range == 0)
+	// Splits the characters [0, size) into classes of characters for which 
+	// every matcher does the same transition
+	struct partition
+	{
+		constexpr partition(std::size_t size) : of(size, 0) {}
+		
+		// split the classes with the outcomes of a transition over [lo, lo + outcome.size()), 
+		// outcome 0 being the one of every other character
+		constexpr void refine(int lo, const buffer<int>& outcome)
 		{
-			// this case is common, e.g. when there is only a string matcher left
-			if (*src == min)
+			++round;
+			splits.clear();
+			
+			for (std::size_t k = 0; k < outcome.size(); ++k)
 			{
-				IMPL( min )
+				if (outcome[k] == 0)
+					continue;
+				
+				auto& c = of[lo + k];
+				
+				if (seen[c] != round)
+				{
+					seen[c] = round;
+					head[c] = -1;
+				}
+				
+				// the classes this class was split into, by outcome
+				int j = head[c];
+				while (j != -1 && splits[j] != outcome[k]) 
+					j = splits[j + 2];
+				
+				if (j == -1)
+				{
+					j = splits.size();
+					splits.push_back(outcome[k]);
+					splits.push_back(count++);
+					splits.push_back(head[c]);
+					head[c] = j;
+					
+					seen.push_back(0);
+					head.push_back(-1);
+				}
+				c = splits[j + 1];
 			}
 		}
-		else if constexpr (Range + 1 <= 5)
+		
+		// refine with the transitions of a matcher, the characters being offset by first
+		template <class M>
+		constexpr void refine(const M& m, int first)
 		{
-			switch(static_cast<unsigned char>(*src))
+			buffer<M> seen;
+			buffer<int> outcome;
+			
+			const int lo = m.min() - first;
+			const int hi = m.max() - first;
+			
+			for (int k = lo; k <= hi; ++k)
 			{
-				REP5( min )
-				default : 
-					break;
+				const M n = m.get_next(static_cast<char>(first + k));
+				int id = 0;
+				
+				if (n.status() == running)
+				{
+					while (id < int(seen.size()) && not impl::same_state(seen[id], n)) ++id;
+					if (id == int(seen.size()))
+						seen.push_back(n);
+					++id;
+				}
+				outcome.push_back(id);
 			}
+			
+			refine(lo, outcome);
 		}
-		else if constexpr (Range + 1 <= 15)
+		
+		buffer<int> of;
+		int count = 1;
+		
+		// for each class, the last round which split it, and its first split in that round
+		int round = 0;
+		buffer<int> seen = buffer<int>(1, 0);
+		buffer<int> head = buffer<int>(1, -1);
+		buffer<int> splits; // (outcome, new class, next split of the same class)
+	};
+	
+	// The classes of the characters [first, first + Size), 
+	// numbered in order of appearance
+	template <std::size_t Size>
+	struct byte_classes
+	{
+		static constexpr auto size = Size;
+		
+		constexpr byte_classes() = default;
+		
+		constexpr byte_classes(const partition& p)
 		{
-			switch(static_cast<unsigned char>(*src))
+			buffer<int> id(p.count, -1);
+			count = 0;
+			for (std::size_t k = 0; k < Size; ++k)
 			{
-				REP15( min )
-				default : 
-					break;
+				auto& c = id[p.of[k]];
+				if (c == -1)
+				{
+					c = count;
+					rep[count++] = k;
+				}
+				of[k] = c;
 			}
 		}
-		else if constexpr (Range + 1 <= 30)
+		
+		unsigned char of[Size] {};  // the class of each character
+		unsigned char rep[Size] {}; // a character of each class (relative to first)
+		int count = 1;
+	};
+	
+	// ====================================================================
+	
+	// The characters on which a state of an automaton loops back to itself (e.g. the rest of an identifier), 
+	// as a few ranges of bytes, so that runs of them are skipped many at a time. 
+	// count is 0 if the state doesn't loop, or loops on too many ranges.
+	struct char_ranges
+	{
+		static constexpr int max_count = 4;
+		
+		constexpr char_ranges() = default;
+		
+		constexpr char_ranges(const bool (&loops)[256])
 		{
-			switch(static_cast<unsigned char>(*src))
+			for (int b = 0; b < 256; ++b)
 			{
-				REP30( min )
-				default :
-					break;
+				if (not loops[b])
+					continue;
+				
+				if (count != 0 && hi[count - 1] == b - 1)
+				{
+					hi[count - 1] = b;
+					continue;
+				}
+				
+				if (count == max_count)
+				{
+					count = 0;
+					return;
+				}
+				
+				lo[count] = hi[count] = b;
+				++count;
 			}
 		}
-		else if constexpr (Range + 1 <= 50)
+		
+		constexpr bool has(char c) const
+		{
+			const auto b = static_cast<unsigned char>(c);
+			bool res = false;
+			for (int k = 0; k < count; ++k)
+				res |= (lo[k] <= b) & (b <= hi[k]);
+			return res;
+		}
+		
+		unsigned char lo[max_count] {}, hi[max_count] {};
+		int count = 0;
+	};
+	
+	// the first character of [p, last) which isn't in r, 64, 32 or 16 characters at a time, 
+	// depending on the instruction set. Less than 16 characters are left to the caller.
+	inline const char* skip_ranges_simd(const char_ranges& r, const char* p, const char* last)
+	{
+	#if defined(__AVX512BW__)
+		for (; last - p >= 64; p += 64)
 		{
-			switch(static_cast<unsigned char>(*src))
+			const __m512i v = _mm512_loadu_si512(p);
+			__mmask64 in = 0;
+			
+			for (int k = 0; k < r.count; ++k)
 			{
-				REP50( min )
-				default :
-					break;
+				const __m512i t = _mm512_sub_epi8(v, _mm512_set1_epi8(static_cast<char>(r.lo[k])));
+				in |= _mm512_cmple_epu8_mask(t, _mm512_set1_epi8(static_cast<char>(r.hi[k] - r.lo[k])));
 			}
+			
+			if (const std::uint64_t out = ~in)
+				return p + std::countr_zero(out);
 		}
-		else if constexpr (Range + 1 <= 100)
+	#elif defined(__AVX2__)
+		for (; last - p >= 32; p += 32)
 		{
-			switch(static_cast<unsigned char>(*src))
+			const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			__m256i in = _mm256_setzero_si256();
+			
+			// x - lo <= hi - lo, unsigned : min(x - lo, hi - lo) == x - lo
+			for (int k = 0; k < r.count; ++k)
 			{
-				REP100( min )
-				default :
-					break;
+				const __m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8(static_cast<char>(r.lo[k])));
+				const __m256i w = _mm256_set1_epi8(static_cast<char>(r.hi[k] - r.lo[k]));
+				in = _mm256_or_si256(in, _mm256_cmpeq_epi8(_mm256_min_epu8(t, w), t));
 			}
+			
+			if (const auto out = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(in)))
+				return p + std::countr_zero(out);
 		}
-		else
+	#endif
+	#if defined(__SSE2__) || defined(_M_X64)
+		for (; last - p >= 16; p += 16)
 		{
-			switch(static_cast<unsigned char>(*src))
+			const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			__m128i in = _mm_setzero_si128();
+			
+			for (int k = 0; k < r.count; ++k)
 			{
-				REP255(0)
-				default :
-					break;
+				const __m128i t = _mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>(r.lo[k])));
+				const __m128i w = _mm_set1_epi8(static_cast<char>(r.hi[k] - r.lo[k]));
+				in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(t, w), t));
 			}
+			
+			if (const auto out = ~static_cast<std::uint32_t>(_mm_movemask_epi8(in)) & 0xFFFF)
+				return p + std::countr_zero(out);
 		}
+	#else
+		(void)r;
+		(void)last;
+	#endif
+		return p;
+	}
 	
-		// Instead of having the final branch at every case, and generating more code than we need
-		// we can put it here at the end of the function. However we're assuming that
-		// no matcher will ever not generate a "fail" status when receiving a 0, which is
-		// probably a fair assumption?
-		
-		using NextList = typename List::template get_next<0>;
-		
-		constexpr auto idx = NextList::action_index;
-		
-		if constexpr ( idx != -1 )
+	// skip the characters of r from src
+	template <class Iter, class Sent>
+	constexpr Iter skip_ranges(const char_ranges& r, Iter src, const Sent& end)
+	{
+		// the vectorized loop needs to know where the input ends, it never reads past it
+		if constexpr ( contiguous_chars<Iter> && std::sized_sentinel_for<Sent, Iter> )
 		{
-			auto& res = impl::get<idx>( actions );
-			if constexpr ( requires {res();} )
-				return res();
-			else
-				return res;
-		}
+			// most runs are short (e.g. identifiers) : the first characters are checked one by one
+			for (int k = 0; k < 8; ++k)
+			{
+				if (src == end || not r.has(*src))
+					return src;
+				++src;
+			}
+			
+			if (not std::is_constant_evaluated())
+			{
+				const char* first = std::to_address(src);
+				src += impl::skip_ranges_simd(r, first, first + (end - src)) - first;
+			}
+		}
+		
+		while (src != end && r.has(static_cast<char>(*src)))
+			++src;
+		return src;
+	}
+	
+	// ====================================================================
+	
+	// The result of a case : a value, or a callable which may take the alternative of the matcher
+	constexpr decltype(auto) evaluate(auto& action, int alternative = -1)
+	{
+		if constexpr ( requires { action(); } )
+			return action();
+		else if constexpr ( requires { action(alternative); } )
+			return action(alternative);
+		else
+			return static_cast<std::decay_t<decltype(action)>>(action);
+	}
+	
+	// the alternative of a matcher which matches several things (e.g. keywords), -1 otherwise
+	template <class M>
+	constexpr int alternative_of(const M& m)
+	{
+		if constexpr ( requires { m.alternative(); } )
+			return m.alternative();
+		else
+			return -1;
+	}
+	
+	// the matcher accepts the input read so far : a zero byte ends it, 
+	// unless the matcher tells otherwise (e.g. a regex which goes on with zero bytes)
+	template <class M>
+	constexpr bool accepts(const M& m)
+	{
+		if constexpr ( requires { m.accepts(); } )
+			return m.accepts();
+		else
+			return m.get_next(0).status() == matched;
+	}
+	
+	template <class M>
+	inline constexpr bool classifies = requires (const char* it) { M::classify(it, it); };
+	
+	// The input matched by a case : a string_view for contiguous inputs, the pair of iterators otherwise
+	template <class Iterator>
+	constexpr auto lexeme(const Iterator& first, const Iterator& last)
+	{
+		if constexpr ( contiguous_chars<Iterator> )
+			return std::string_view{ std::to_address(first), static_cast<std::size_t>(last - first) };
+		else
+			return std::pair<Iterator, Iterator>{ first, last };
+	}
+	
+	// an action which takes nothing or the alternative (e.g. a generic lambda) keeps getting that
+	template <class Action, class Iterator>
+	inline constexpr bool takes_lexeme = 
+		not requires (Action& a) { a(); } && 
+		not requires (Action& a, int alt) { a(alt); } && 
+		(
+			requires (Action& a, const Iterator& it, int alt) { a(impl::lexeme(it, it), alt); } || 
+			requires (Action& a, const Iterator& it) { a(impl::lexeme(it, it)); }
+		);
+	
+	template <class M>
+	inline constexpr bool carries_value = requires (const char* it) { M::value(it, it); };
+	
+	// the matcher computes a value (e.g. int_value_matcher), which the action takes
+	template <class M, class Action, class Iterator>
+	inline constexpr bool takes_value = requires (Action& a, const Iterator& it) { a(M::value(it, it)); };
+	
+	// An action which needs the input it matched, once src is at the end of the match : 
+	// - the matcher classifies it (e.g. keyword_identifier_matcher), the alternative is computed on [first, src)
+	// - the matcher computes its value, and the action takes it
+	// - the action takes the lexeme, and maybe the alternative after it
+	template <class M, class Action, class Iterator>
+	struct bound_action
+	{
+		constexpr decltype(auto) operator()(int alternative)
+		{
+			if constexpr ( classifies<M> )
+				alternative = M::classify(first, src);
+			
+			if constexpr ( takes_value<M, Action, Iterator> )
+				return action(M::value(first, src));
+			else if constexpr ( not takes_lexeme<Action, Iterator> )
+				return impl::evaluate( action, alternative );
+			else if constexpr ( requires { action(impl::lexeme(first, src), alternative); } )
+				return action(impl::lexeme(first, src), alternative);
+			else
+				return action(impl::lexeme(first, src));
+		}
+		
+		Action action;
+		const Iterator& first;
+		Iterator& src;
+	};
+	
+	// first must live until the action is evaluated
+	template <class M, class Action, class Iterator>
+	constexpr auto bind_action(const Action& action, const Iterator& first, Iterator& src)
+	{
+		if constexpr ( classifies<M> || takes_value<M, Action, Iterator> || takes_lexeme<Action, Iterator> )
+			return bound_action<M, Action, Iterator>{ action, first, src };
+		else
+			return action;
+	}
+	
+	// the alternative of the case idx once it matched [first, last)
+	template <class... Matchers, class Iterator>
+	constexpr int classify(int idx, int alternative, Iterator first, Iterator last)
+	{
+		if constexpr ( (classifies<Matchers> || ...) )
+		{
+			int k = 0;
+			auto f = [&] <class M> () {
+				if constexpr ( classifies<M> )
+				{
+					if (k == idx) 
+						alternative = M::classify(first, last);
+				}
+				++k;
+			};
+			(f.template operator()<Matchers>(), ...);
+		}
+		return alternative;
+	}
+	
+	// the case Index, which matched before the position where the automaton stopped
+	template <class Result, class Iterator, int Index = -1>
+	struct fallback
+	{
+		constexpr decltype(auto) operator()(Iterator& dest) 
+		{
+			STRM_COUNT( if (probe) *probe = { Index, impl::count_between(saved_iterator, dest) } )
+			
+			dest = saved_iterator;
+			return impl::evaluate(result, alternative);
+		}
+		
+		Result result;
+		Iterator saved_iterator;
+		int alternative = -1;
+	};
+	
+	template <class R, class I>
+	fallback(R, I, int) -> fallback<R, I>;
+	
+	template <class Action>
+	struct default_case 
+	{ 
+		constexpr decltype(auto) operator()(auto)
+		{
+			STRM_COUNT( if (probe) *probe = {} )
+			
+			return impl::evaluate(action);
+		}
+		
+		Action action;
+	};
+	
+	template <class A>
+	default_case(A) -> default_case<A>;
+	
+	// ====================================================================
+	
+	template <int A, class... Ts>
+	struct matcher_list;
+	
+	// traverse the status array and pick the matchers
+	template <char Pick, bool LookForMatch>
+	struct make_next_list 
+	{
+		template <int Clk, auto Data, class Head, class... Tail> 
+		using f = typename make_next_list< Head::matcher.status(), LookForMatch >
+			::template f<(Clk - 1), Data, Head, Tail...>;
+	};
+	
+	// -2 : pick
+	// -1 : stop
+	// 0 : matcher is running, keep it
+	// 1 : matcher successful, update state and toss it
+	// 2 : matcher failed, toss it
+	
+	template <bool B>
+	struct make_next_list<-1, B> 
+	{
+		template <int, auto Data, class... Ts>
+		using f = matcher_list< Data, Ts... >;
+	};
+	
+	template <bool B>
+	struct make_next_list<0, B> 
+	{
+		template <int Clk, auto Data, class Head, class... Tail>
+		using f = typename make_next_list< (Clk == 0 ? -1 : -2), B >
+			::template f<Clk, Data, Tail..., Head>;
+	};
+	
+	// Found a "matched" status, filter it out and update the CurrentActionIndex
+	template <>
+	struct make_next_list<1, true>
+	{
+		template <int Clk, auto Data, class Head, class... Tail>
+		using f = typename make_next_list< (Clk == 0 ? -1 : -2), false>
+			::template f<Clk, Head::index, Tail...>;
+	};
+	
+	// Found a "matched" but we don't care cause we already found a "matched" in this row
+	template <>
+	struct make_next_list<1, false>
+	{
+		template <int Clk, auto Data, class Head, class... Tail>
+		using f = typename make_next_list< (Clk == 0 ? -1 : -2), false>
+			::template f<Clk, Data, Tail...>;
+	};
+	
+	// Filter out the matcher
+	template <bool B>
+	struct make_next_list<2, B> 
+	{	
+		template <int Clk, auto Data, class Head, class... Tail>
+		using f = typename make_next_list< (Clk == 0 ? -1 : -2), B >
+			::template f<Clk, Data, Tail...>;
+	};
+	
+	template <auto Data, class... Cases>
+	using make_next_list_t =
+	typename make_next_list<-2, (sizeof...(Cases) < 100000000000000)> // trick the compiler into deferring the alias
+		::template f
+		<sizeof...(Cases), 
+		 Data, 
+		 Cases...
+		>;
+		
+	// ====================================================================
+	
+	// A case is dominated by a previous one in the same state : they will run the same way, 
+	// and the previous one has priority. Filtering them out merges the lists which behave the same.
+	template <class A, class B>
+	constexpr bool dominates()
+	{
+		if constexpr ( std::is_same_v<decltype(A::matcher), decltype(B::matcher)> )
+			return impl::same_state(A::matcher, B::matcher);
+		else
+			return false;
+	}
+	
+	template <class List, class... Cases>
+	struct unique_cases { using type = List; };
+	
+	template <class... Kept, class Head, class... Tail>
+	struct unique_cases< matcher_list<-1, Kept...>, Head, Tail... > 
+	: unique_cases< 
+		std::conditional_t< (impl::dominates<Kept, Head>() || ...), 
+			matcher_list<-1, Kept...>, 
+			matcher_list<-1, Kept..., Head> >, 
+		Tail... 
+	  > 
+	{};
+	
+	template <int ActionIdx, class... Cases>
+	struct matcher_list
+	{	
+		static constexpr auto action_index = ActionIdx;
+		
+		static constexpr bool failed = false;
+		static constexpr auto min = strm::min({static_cast<char>(Cases::matcher.min())...});
+		static constexpr auto max = strm::max({static_cast<char>(Cases::matcher.max())...});
+		static constexpr bool can_fail = (Cases::matcher.can_fail() && ...);
+		
+		template <char C> 
+		using get_next = make_next_list_t<-1, typename Cases::template get_next<C>...>;
+		
+		// the same list, without the index of the case which matched on the way here, 
+		// so that lists holding the same matchers share a single match_impl instantiation
+		using state = typename unique_cases< matcher_list<-1>, Cases... >::type;
+		
+		// the case that matches if the input stops here (-1 if none), the first one in the list
+		static constexpr int accept_index = [] {
+			int res = -1;
+			((res == -1 && impl::accepts(Cases::matcher) ? (res = Cases::index) : 0), ...);
+			return res;
+		}();
+		
+		// and the alternative of its matcher
+		static constexpr int accept_alternative = [] {
+			int res = -1;
+			((Cases::index == accept_index ? (res = impl::alternative_of(Cases::matcher)) : 0), ...);
+			return res;
+		}();
+		
+		static constexpr auto make_classes()
+		{
+			partition p(max - min + 1);
+			(p.refine(Cases::matcher, min), ...);
+			return byte_classes<max - min + 1>{p};
+		}
+	};
+	
+	template <class List>
+	inline constexpr auto list_classes = List::make_classes();
+	
+	// Dispatch on the classes of characters rather than the characters themselves, 
+	// if it removes at least a quarter of the cases. Small ranges are cheap enough as they are.
+	template <class List>
+	constexpr bool dispatch_by_class()
+	{
+		constexpr int size = List::max - List::min + 1;
+		if constexpr (size <= 5)
+			return false;
+		else
+			return list_classes<List>.count * 4 <= size * 3;
+	}
+	
+	// whether the state List goes back to itself on the character C
+	template <class List, char C>
+	constexpr bool loops_on()
+	{
+		using next = typename List::template get_next<C>;
+		
+		if constexpr ( next::failed )
+			return false;
+		else
+			return std::is_same_v<typename next::state, List>;
+	}
+	
+	template <class List>
+	constexpr char_ranges make_self_loop()
+	{
+		constexpr int size = List::max - List::min + 1;
+		bool loops[256] {};
+		
+		if constexpr ( impl::dispatch_by_class<List>() )
+		{
+			constexpr auto& classes = impl::list_classes<List>;
+			bool class_loops[256] {};
+			
+			[&] <std::size_t... K> (std::index_sequence<K...>) {
+				((class_loops[K] = impl::loops_on< List, static_cast<char>(List::min + classes.rep[K]) >()), ...);
+			}(std::make_index_sequence<classes.count>{});
+			
+			for (int k = 0; k < size; ++k)
+				loops[static_cast<unsigned char>(static_cast<char>(List::min + k))] = class_loops[classes.of[k]];
+		}
+		else
+		{
+			[&] <std::size_t... K> (std::index_sequence<K...>) {
+				((loops[static_cast<unsigned char>(static_cast<char>(List::min + K))] = 
+					impl::loops_on< List, static_cast<char>(List::min + K) >()), ...);
+			}(std::make_index_sequence<size>{});
+		}
+		
+		return char_ranges{loops};
+	}
+	
+	template <class List>
+	inline constexpr auto self_loop = impl::make_self_loop<List>();
+	
+	struct no_profile {};
+	
+	// A run of characters [lo, hi] which all lead to the same next state (or all end the match),
+	// tested before the switch
+	struct hot_run
+	{
+		char lo = 0, hi = 0;
+		bool ends = false;   // the match stops on these characters
+		bool likely = false; // they are at least half of the input
+	};
+	
+	struct hot_runs
+	{
+		static constexpr int max_count = 2;
+		
+		hot_run runs[max_count];
+		int count = 0;
+	};
+	
+	// The runs of characters of the state List which are at least an eighth of the input, most frequent first.
+	// Consecutive characters belong to the same run when they are in the same class,
+	// or when they are all outside of the classes where List keeps going.
+	template <class List>
+	constexpr hot_runs make_hot_runs(const byte_weights& w)
+	{
+		constexpr int size = List::max - List::min + 1;
+		constexpr auto& classes = impl::list_classes<List>;
+		
+		bool class_ends[256] {};
+		[&] <std::size_t... K> (std::index_sequence<K...>) {
+			((class_ends[K] = List::template get_next< static_cast<char>(List::min + classes.rep[K]) >::failed), ...);
+		}(std::make_index_sequence<classes.count>{});
+		
+		// the outcome of each character, in char order : its class, or -1 if the match stops there
+		auto outcome = [&] (int c) {
+			const int k = c - List::min;
+			return (k < 0 || k >= size || class_ends[classes.of[k]]) ? -1 : int(classes.of[k]);
+		};
+		
+		std::uint64_t total = 0;
+		for (unsigned x : w.weight)
+			total += x;
+		
+		hot_runs res;
+		if (total == 0)
+			return res;
+		
+		hot_run candidates[256];
+		std::uint64_t weights[256] {};
+		int count = 0;
+		
+		for (int c = std::numeric_limits<char>::min(); c <= std::numeric_limits<char>::max(); ++c)
+		{
+			if (count == 0 || outcome(c) != outcome(c - 1))
+			{
+				candidates[count] = { static_cast<char>(c), static_cast<char>(c), outcome(c) == -1, false };
+				++count;
+			}
+			candidates[count - 1].hi = static_cast<char>(c);
+			weights[count - 1] += w.weight[static_cast<unsigned char>(c)];
+		}
+		
+		while (res.count < hot_runs::max_count)
+		{
+			int best = 0;
+			for (int k = 1; k < count; ++k)
+				if (weights[k] > weights[best]) best = k;
+			
+			if (weights[best] * 8 < total)
+				break;
+			
+			candidates[best].likely = weights[best] * 2 >= total;
+			res.runs[res.count++] = candidates[best];
+			weights[best] = 0;
+		}
+		return res;
+	}
+	
+	template <class List, class Profile>
+	inline constexpr auto hot_runs_of = impl::make_hot_runs<List>(Profile::weights);
+	
+	template <int ActionIdx>
+	struct matcher_list<ActionIdx>
+	{
+		static constexpr auto action_index = ActionIdx;
+		static constexpr bool failed = true;
+	};
+	
+	template <class... Ts>
+	matcher_list(Ts...) -> matcher_list<-1, Ts...>;
+	
+	template <auto M, std::size_t Idx>
+	struct w_index {
+		static constexpr auto index = Idx;
+		static constexpr auto matcher = M;
+		
+		template <char C>
+		using get_next = w_index<M.get_next(C), Idx>;
+	};
+	
+	template <class Seq>
+	struct make_list_impl;
+	
+	template <std::size_t... Idx>
+	struct make_list_impl<std::index_sequence<Idx...>> {
+	
+		template <class... Ts>
+		using f = matcher_list<-1, w_index<Ts{}, Idx>...>;
+	};
+	
+	template <std::size_t Sz>
+	using make_seq = std::make_index_sequence<Sz>;
+	
+	template <class... Ts>
+	using make_matchers_list = typename make_list_impl< make_seq<sizeof...(Ts)> >::
+		template f <Ts...>;
+
+	#define REP5(N) M(N) M(N + 1) M(N + 2) M(N + 3) M(N + 4)
+	#define REP10(N) REP5(N) REP5(N + 5)
+	#define REP15(N) REP10(N) REP5(N + 10)
+	#define REP30(N) REP10(N) REP10(N + 10) REP10(N + 20)
+	#define REP50(N) REP10(N) REP10(N + 10) REP10(N + 20) REP10(N + 30) REP10(N + 40)
+	#define REP100(N) REP50(N) REP50(N + 50)
+	#define REP255(N) REP100(N) REP100(N + 100) REP50(N + 200) REP5(N + 250)
+	
+	// ==================================================================
+	// match impl
+	
+	// The input stops matching (or ends) while in the state List : 
+	// either List accepts here, or we fall back to the last accepting position
+	template <class List, class Src>
+	auto match_end(Src& src, auto&& current_action, auto&& actions) -> decltype( current_action(src) )
+	{
+		constexpr auto idx = List::accept_index;
+		
+		if constexpr ( idx != -1 )
+		{
+			STRM_COUNT( if (probe) *probe = { idx, 0 } )
+			return impl::evaluate( impl::get<idx>( actions ), List::accept_alternative );
+		}
+		else
+			return current_action(src);
+	}
+	
+	// A state which went back to itself (e.g. in the rest of an identifier) is likely to stay there : 
+	// the characters it loops on are skipped all at once. They change nothing, not even the position 
+	// to fall back to, since the state accepts at the end of the run if it accepted before it.
+	template <class Next, class Prev>
+	void skip_loop(auto& src, const auto& end)
+	{
+		if constexpr ( std::is_same_v<Next, Prev> )
+		{
+			if constexpr ( impl::self_loop<Next>.count != 0 )
+				src = impl::skip_ranges(impl::self_loop<Next>, src, end);
+		}
+	}
+	
+	template <class Next, class Prev, bool FirstAccept, class Profile>
+	decltype(auto) match_impl_tail(auto& src, const auto& end, auto&& current, auto&& actions)
+	{
+		// with the first_accept policy, Next accepting ends the match : we don't go further, 
+		// and there is never a position to save
+		if constexpr ( FirstAccept && Next::accept_index != -1 )
+		{
+			++src;
+			return impl::match_end<Next>( src, STRM_FWD(current), STRM_FWD(actions) );
+		}
+		// Prev accepts before the character we're consuming, save the position 
+		// in case we can't go further. If Next can't fail, a longer match is guaranteed anyway.
+		else if constexpr ( Prev::accept_index != -1 && Next::can_fail )
+		{
+			using action = std::remove_cvref_t<decltype( impl::get<Prev::accept_index>(actions) )>;
+			
+			auto&& next_current = impl::fallback< action, std::remove_cvref_t<decltype(src)>, Prev::accept_index >{
+				impl::get<Prev::accept_index>(actions), src, Prev::accept_alternative
+			};
+			++src;
+			impl::skip_loop<Next, Prev>(src, end);
+			return match_impl<Next, FirstAccept, Profile>( src, end, STRM_FWD(next_current), STRM_FWD(actions) );
+		}
+		else
+		{
+			++src;
+			impl::skip_loop<Next, Prev>(src, end);
+			return match_impl<Next, FirstAccept, Profile>( src, end, STRM_FWD(current), STRM_FWD(actions) );
+		}
+	}
+
+	template <class List, bool FirstAccept = false, class Profile = no_profile, class Src, class Sent>
+	auto match_impl(Src& src, const Sent& end, auto&& current_action, auto&& actions) -> decltype( current_action(src) )
+	{
+		// only the initial state gets here accepting, if a matcher accepts the empty string
+		if constexpr ( FirstAccept && List::accept_index != -1 )
+			return impl::match_end<List>( src, STRM_FWD(current_action), STRM_FWD(actions) );
+		
+		// end of input is a transition of its own, so we never read past it
+		if constexpr ( not std::is_same_v<Sent, std::unreachable_sentinel_t> )
+		{
+			if (src == end)
+				return impl::match_end<List>( src, STRM_FWD(current_action), STRM_FWD(actions) );
+		}
+		
+		constexpr auto min = List::min;
+		constexpr auto max = List::max;
+	
+		#define IMPL(N) \
+			using NextList = typename List::template get_next<N>; \
+			if constexpr ( not NextList::failed ) \
+			{ \
+				return impl::match_impl_tail<typename NextList::state, List, FirstAccept, Profile>(src, end, STRM_FWD(current_action), STRM_FWD(actions)); \
+			} 
+		
+		// a switch over the values [First, First + Size), with enough cases
+		#define SWITCH(VALUE, FIRST, SIZE) \
+			if constexpr (SIZE <= 5) \
+			{ \
+				switch(VALUE) { REP5( FIRST ) default : break; } \
+			} \
+			else if constexpr (SIZE <= 15) \
+			{ \
+				switch(VALUE) { REP15( FIRST ) default : break; } \
+			} \
+			else if constexpr (SIZE <= 30) \
+			{ \
+				switch(VALUE) { REP30( FIRST ) default : break; } \
+			} \
+			else if constexpr (SIZE <= 50) \
+			{ \
+				switch(VALUE) { REP50( FIRST ) default : break; } \
+			} \
+			else if constexpr (SIZE <= 100) \
+			{ \
+				switch(VALUE) { REP100( FIRST ) default : break; } \
+			} \
+			else \
+			{ \
+				switch(VALUE) { REP255( 0 ) M(255) default : break; } \
+			}
+		
+		// with a byte_profile, the frequent runs of characters skip the switch
+		if constexpr ( not std::is_same_v<Profile, no_profile> )
+		{
+			constexpr auto& hot = impl::hot_runs_of<List, Profile>;
+			const char c = static_cast<char>(*src);
+			
+			#define HOT_TAKE(K) \
+				if constexpr ( hot.runs[K].ends ) \
+				{ \
+					return impl::match_end<List>( src, STRM_FWD(current_action), STRM_FWD(actions) ); \
+				} \
+				else \
+				{ \
+					IMPL( hot.runs[K].lo ) \
+				}
+			
+			#define HOT(K) \
+				if constexpr (K < hot.count) \
+				{ \
+					constexpr auto width = static_cast<unsigned char>(hot.runs[K].hi - hot.runs[K].lo); \
+					const bool in_run = static_cast<unsigned char>(c - hot.runs[K].lo) <= width; \
+					 \
+					if constexpr ( hot.runs[K].likely ) \
+					{ \
+						if (in_run) [[likely]] { HOT_TAKE(K) } \
+					} \
+					else \
+					{ \
+						if (in_run) { HOT_TAKE(K) } \
+					} \
+				}
+			
+			static_assert( hot_runs::max_count == 2 );
+			HOT(0)
+			HOT(1)
+			
+			#undef HOT
+			#undef HOT_TAKE
+		}
+		
+		if constexpr ( impl::dispatch_by_class<List>() )
+		{
+			constexpr auto& classes = impl::list_classes<List>;
+			
+			#define M(N) case N : { \
+				 \
+				if constexpr (N < classes.count) \
+				{ \
+					IMPL( static_cast<char>(min + classes.rep[N]) ) \
+				} \
+				break; \
+			} \
+			
+			// characters are ordered as chars, which may be signed 
+			// (the input may also be of char8_t or unsigned char)
+			const unsigned offset = static_cast<unsigned>(static_cast<char>(*src) - min);
+			
+			if (offset < classes.size)
+			{
+				SWITCH( classes.of[offset], 0, classes.count )
+			}
+			
+			#undef M
+		}
+		else
+		{
+			constexpr auto Range = max - min;
+			
+			// the switch is over the offset of the character from min
+			#define M(N) case N : { \
+				 \
+				if constexpr (N <= Range) \
+				{ \
+					IMPL( static_cast<char>(min + N) ) \
+				} \
+				break; \
+			} \
+		
+		
+			if constexpr (Range == 0)
+			{
+				// this case is common, e.g. when there is only a string matcher left
+				if (static_cast<char>(*src) == min)
+				{
+					IMPL( min )
+				}
+			}
+			else
+			{
+				SWITCH( static_cast<unsigned>(static_cast<char>(*src) - min), 0, Range + 1 )
+			}
+			
+			#undef M
+		}
+	
+		// Instead of having the final branch at every case, and generating more code than we need
+		// we put it here at the end of the function.
+		
+		return impl::match_end<List>( src, STRM_FWD(current_action), STRM_FWD(actions) );
+	
+		#undef SWITCH
+		#undef IMPL
+	}
+
+	#undef REP5
+	#undef REP10
+	#undef REP15
+	#undef REP30
+	#undef REP50
+	#undef REP100
+	#undef REP255
+	
+	// ==================================================================
+	// table backend
+	
+	// The characters for which a matcher may keep running, as unsigned bytes
+	template <class M>
+	constexpr void byte_range(const M& m, int& lo, int& hi)
+	{
+		lo = static_cast<unsigned char>(m.min());
+		hi = static_cast<unsigned char>(m.max());
+		if (lo > hi)
+		{
+			lo = 0;
+			hi = 255;
+		}
+	}
+	
+	// The states of every matcher, numbered globally, with their transitions.
+	// These are the building blocks of the product automaton.
+	struct dfa_components
+	{
+		buffer<int> next;       // the next states over [lo, hi] of each state, -1 if the matcher stops running
+		buffer<int> first;      // where the transitions of each state begin in next
+		buffer<int> lo, hi;     // the range of characters for which the matcher may keep running
+		buffer<bool> accepting; // the matcher matches if the input stops in this state
+		buffer<int> owner;      // the case index of each state
+		buffer<int> alternative;// the alternative of the matcher in each state
+		buffer<int> start;      // the first state of each case (-1 if it can't run at all)
+		
+		constexpr int get_next(int state, int byte) const {
+			return (byte < lo[state] || byte > hi[state]) ? -1 : next[first[state] + byte - lo[state]];
+		}
+	};
+	
+	template <class M>
+	constexpr void add_component(dfa_components& c, M m, int case_index)
+	{
+		if (m.status() != running)
+		{
+			c.start.push_back(-1);
+			return;
+		}
+		
+		const int base = c.owner.size();
+		c.start.push_back(base);
+		
+		buffer<M> states;
+		states.push_back(m);
+		
+		for (std::size_t k = 0; k < states.size(); ++k)
+		{
+			const M s = states[k];
+			int lo = 0, hi = 0;
+			impl::byte_range(s, lo, hi);
+			
+			c.owner.push_back(case_index);
+			c.accepting.push_back(impl::accepts(s));
+			c.alternative.push_back(impl::alternative_of(s));
+			c.first.push_back(c.next.size());
+			c.lo.push_back(lo);
+			c.hi.push_back(hi);
+			
+			for (int b = lo; b <= hi; ++b)
+			{
+				const M n = s.get_next(static_cast<char>(b));
+				int id = -1;
+				
+				if (n.status() == running)
+				{
+					for (std::size_t j = 0; j < states.size(); ++j)
+						if (impl::same_state(states[j], n)) { id = j; break; }
+					
+					if (id == -1)
+					{
+						id = states.size();
+						states.push_back(n);
+					}
+					id += base;
+				}
+				c.next.push_back(id);
+			}
+		}
+	}
+	
+	// A matcher whose states are numbered (e.g. regex_matcher) : M::states is their number, 
+	// and M{s} the matcher in the state s. 
+	// It may also list the transitions of a state as runs of bytes, with M::for_each_run(s, f), 
+	// f being called with (first byte, last byte, next state).
+	template <class M>
+	concept indexed_matcher = requires (const M m) {
+		int(M::states);
+		M{ int{} };
+		int(m.state_);
+	};
+	
+	// The states of an indexed matcher are known, no need to look for the states already seen
+	template <indexed_matcher M>
+	constexpr void add_component(dfa_components& c, M m, int case_index)
+	{
+		if (m.status() != running)
+		{
+			c.start.push_back(-1);
+			return;
+		}
+		
+		const int base = c.owner.size();
+		c.start.push_back(base + m.state_);
+		
+		for (int n = 0; n < M::states; ++n)
+		{
+			const M s{n};
+			int lo = 0, hi = 0;
+			impl::byte_range(s, lo, hi);
+			
+			c.owner.push_back(case_index);
+			c.accepting.push_back(impl::accepts(s));
+			c.alternative.push_back(impl::alternative_of(s));
+			c.first.push_back(c.next.size());
+			c.lo.push_back(lo);
+			c.hi.push_back(hi);
+			
+			if constexpr ( requires { M::for_each_run(n, [] (int, int, int) {}); } )
+			{
+				const int from = c.next.size();
+				
+				for (int b = lo; b <= hi; ++b)
+					c.next.push_back(-1);
+				
+				M::for_each_run(n, [&] (int first, int last, int next) {
+					for (int b = first; b <= last; ++b)
+						c.next[from + b - lo] = base + next;
+				});
+			}
+			else
+			{
+				for (int b = lo; b <= hi; ++b)
+				{
+					const M x = s.get_next(static_cast<char>(b));
+					c.next.push_back( (x.status() == running) ? base + x.state_ : -1 );
+				}
+			}
+		}
+	}
+	
+	// The states of a keywords matcher are the nodes of its trie, 
+	// no need to look for the states already seen
+	template <class Set>
+	constexpr void add_component(dfa_components& c, keywords_matcher<Set> m, int case_index)
+	{
+		constexpr auto& trie = Set::trie;
+		
+		if (m.status() != running)
+		{
+			c.start.push_back(-1);
+			return;
+		}
+		
+		const int base = c.owner.size() - m.state_;
+		c.start.push_back(base + m.state_);
+		
+		for (int n = m.state_; n < trie.size; ++n)
+		{
+			const keywords_matcher<Set> s{n};
+			int lo = 0, hi = 0;
+			impl::byte_range(s, lo, hi);
+			
+			c.owner.push_back(case_index);
+			c.accepting.push_back(trie.nodes[n].keyword != -1);
+			c.alternative.push_back(trie.nodes[n].keyword);
+			c.first.push_back(c.next.size());
+			c.lo.push_back(lo);
+			c.hi.push_back(hi);
+			
+			for (int b = lo; b <= hi; ++b)
+				c.next.push_back(-1);
+			
+			for (int k = trie.nodes[n].child; k != -1; k = trie.nodes[k].sibling)
+				c.next[ c.first[base + n] + static_cast<unsigned char>(trie.nodes[k].c) - lo ] = base + k;
+		}
+	}
+	
+	// The product automaton. A state is the (sorted) list of the component states still running, 
+	// state 0 is the dead state and state 1 the starting one.
+	struct product_dfa
+	{
+		std::size_t states = 0;
+		byte_classes<256> classes;
+		buffer<int> next;   // [state * classes.count + class]
+		buffer<int> accept; // the case that matches if the input stops in this state, -1 if none
+		buffer<int> alternative; // and the alternative of its matcher
+		
+		constexpr auto shape() const { 
+			return std::pair<std::size_t, std::size_t>{states, classes.count}; 
+		}
+	};
+	
+	// the classes of characters for which every state of every matcher does the same transition
+	constexpr byte_classes<256> make_classes(const dfa_components& c)
+	{
+		partition p(256);
+		buffer<int> outcome;
+		buffer<int> seen;
+		
+		// the outcome of each next state (+1, the dead state being -1), 0 if not seen yet
+		buffer<int> id_of(c.owner.size() + 1, 0);
+		
+		for (std::size_t g = 0; g < c.owner.size(); ++g)
+		{
+			outcome.clear();
+			seen.clear();
+			seen.push_back(-1);
+			id_of[0] = 1;
+			
+			for (int b = c.lo[g]; b <= c.hi[g]; ++b)
+			{
+				const auto n = c.get_next(g, b);
+				auto& id = id_of[n + 1];
+				if (id == 0)
+				{
+					seen.push_back(n);
+					id = seen.size();
+				}
+				outcome.push_back(id - 1);
+			}
+			
+			for (std::size_t k = 0; k < seen.size(); ++k)
+				id_of[ seen[k] + 1 ] = 0;
+			
+			p.refine(c.lo[g], outcome);
+		}
+		
+		return byte_classes<256>{p};
+	}
+	
+	constexpr std::size_t hash_state(const int* first, const int* last)
+	{
+		std::size_t h = 14695981039346656037ull;
+		for (; first != last; ++first)
+			h = (h ^ static_cast<std::size_t>(*first)) * 1099511628211ull;
+		return h;
+	}
+	
+	constexpr product_dfa build_product(const dfa_components& c)
+	{
+		product_dfa res;
+		
+		buffer<int> pool;          // the component lists of every state, back to back
+		buffer<std::size_t> first; // where each state begins in the pool
+		buffer<int> slots(64, -1); // open-addressing hash table of the states
+		
+		auto find_or_insert = [&] (const buffer<int>& list) -> int 
+		{
+			if (list.size() == 0)
+				return 0;
+			
+			auto mask = slots.size() - 1;
+			auto h = impl::hash_state(list.data_, list.data_ + list.size()) & mask;
+			
+			for (;; h = (h + 1) & mask)
+			{
+				auto s = slots[h];
+				if (s == -1)
+					break;
+				auto sz = first[s + 1] - first[s];
+				if (sz != list.size())
+					continue;
+				bool same = true;
+				for (std::size_t k = 0; k < sz && same; ++k)
+					same = (pool[first[s] + k] == list[k]);
+				if (same)
+					return s;
+			}
+			
+			int id = first.size() - 1;
+			slots[h] = id;
+			for (std::size_t k = 0; k < list.size(); ++k) pool.push_back(list[k]);
+			first.push_back(pool.size());
+			
+			// keep the load factor under 1/2
+			if (2 * first.size() > slots.size())
+			{
+				buffer<int> grown(slots.size() * 2, -1);
+				auto m = grown.size() - 1;
+				for (std::size_t s = 1; s + 1 < first.size(); ++s)
+				{
+					auto g = impl::hash_state(pool.data_ + first[s], pool.data_ + first[s + 1]) & m;
+					while (grown[g] != -1) g = (g + 1) & m;
+					grown[g] = s;
+				}
+				slots = static_cast<buffer<int>&&>(grown);
+			}
+			return id;
+		};
+		
+		res.classes = impl::make_classes(c);
+		
+		// the state where a component state runs alone, which is common (e.g. the tail of an identifier)
+		buffer<int> alone(c.owner.size(), -1);
+		
+		// the dead state
+		first.push_back(0);
+		first.push_back(0);
+		
+		buffer<int> list;
+		
+		for (std::size_t k = 0; k < c.start.size(); ++k)
+			if (c.start[k] != -1) list.push_back(c.start[k]);
+		
+		// the starting state must be 1, even if nothing can run
+		if (list.size() == 0)
+			first.push_back(0);
+		else
+			find_or_insert(list);
+		
+		for (std::size_t s = 0; s + 1 < first.size(); ++s)
+		{
+			int accept = -1, alternative = -1;
+			int lo = 256, hi = -1;
+			
+			for (auto k = first[s]; k != first[s + 1]; ++k)
+			{
+				auto g = pool[k];
+				if (accept == -1 && c.accepting[g])
+				{
+					accept = c.owner[g];
+					alternative = c.alternative[g];
+				}
+				lo = c.lo[g] < lo ? c.lo[g] : lo;
+				hi = c.hi[g] > hi ? c.hi[g] : hi;
+			}
+			res.accept.push_back(accept);
+			res.alternative.push_back(alternative);
+			
+			for (int k = 0; k < res.classes.count; ++k)
+			{
+				const int b = res.classes.rep[k];
+				
+				if (b < lo || b > hi)
+				{
+					res.next.push_back(0);
+					continue;
+				}
+				
+				// a single component state running, no list to build
+				if (first[s + 1] - first[s] == 1)
+				{
+					const auto n = c.get_next(pool[first[s]], b);
+					
+					if (n != -1 && alone[n] == -1)
+					{
+						list.clear();
+						list.push_back(n);
+						alone[n] = find_or_insert(list);
+					}
+					res.next.push_back( (n == -1) ? 0 : alone[n] );
+					continue;
+				}
+				
+				list.clear();
+				for (auto k = first[s]; k != first[s + 1]; ++k)
+				{
+					auto n = c.get_next(pool[k], b);
+					if (n != -1) list.push_back(n);
+				}
+				
+				if (list.size() == 1 && alone[list[0]] != -1)
+					res.next.push_back(alone[list[0]]);
+				else
+				{
+					const auto a = find_or_insert(list);
+					if (list.size() == 1)
+						alone[list[0]] = a;
+					res.next.push_back(a);
+				}
+			}
+		}
+		
+		res.states = first.size() - 1;
+		return res;
+	}
+	
+	// Moore's partition refinement : the classes of equivalent states of an automaton, 
+	// given the transitions [state * columns + column] (-1 for none) and a label of each state.
+	// States are equivalent if they have the same label, and go to equivalent states. 
+	// Classes are numbered in order of appearance.
+	constexpr buffer<int> equivalent_states(std::size_t states, int columns, const buffer<int>& next, const buffer<int>& label)
+	{
+		buffer<int> block(states, 0);
+		buffer<int> sizes;  // the number of states in each class
+		
+		std::size_t size = 64;
+		while (size < 2 * states) size *= 2;
+		const auto mask = size - 1;
+		
+		// number the states by their class in the previous round and the classes of their successors 
+		// (by their label in the first round), returns the number of classes
+		auto refine = [&] (bool first_round) 
+		{
+			auto successor = [&] (std::size_t s, int k) {
+				auto t = next[s * columns + k];
+				return (t == -1) ? -1 : block[t];
+			};
+			
+			auto hash = [&] (std::size_t s) 
+			{
+				if (first_round)
+					return impl::hash_state(&label[s], &label[s] + 1);
+				
+				std::size_t h = 14695981039346656037ull ^ static_cast<std::size_t>(block[s]);
+				
+				// a class of a single state can't be split anymore
+				if (sizes[block[s]] == 1)
+					return h;
+				
+				for (int k = 0; k < columns; ++k)
+					h = (h ^ static_cast<std::size_t>(successor(s, k))) * 1099511628211ull;
+				return h;
+			};
+			
+			auto same = [&] (std::size_t s, std::size_t r) 
+			{
+				if (first_round)
+					return label[s] == label[r];
+				
+				if (block[s] != block[r])
+					return false;
+				if (sizes[block[s]] == 1)
+					return true;
+				for (int k = 0; k < columns; ++k)
+					if (successor(s, k) != successor(r, k)) return false;
+				return true;
+			};
+			
+			buffer<int> slots(size, -1); // the representative state of each class
+			buffer<int> res(states, 0);
+			int n = 0;
+			
+			for (std::size_t s = 0; s < states; ++s)
+			{
+				for (auto h = hash(s) & mask;; h = (h + 1) & mask)
+				{
+					if (slots[h] == -1)
+					{
+						slots[h] = s;
+						res[s] = n++;
+						break;
+					}
+					if (same(s, slots[h]))
+					{
+						res[s] = res[slots[h]];
+						break;
+					}
+				}
+			}
+			
+			block = static_cast<buffer<int>&&>(res);
+			
+			sizes = buffer<int>(n, 0);
+			for (std::size_t s = 0; s < states; ++s)
+				++sizes[block[s]];
+			
+			return n;
+		};
+		
+		for (int count = refine(true);;)
+		{
+			const int n = refine(false);
+			if (n == count)
+				break;
+			count = n;
+		}
+		
+		return block;
+	}
+	
+	// The minimal automaton : states which accept the same case in the same way, 
+	// and lead to equivalent states, are merged
+	constexpr product_dfa minimize(const product_dfa& dfa)
+	{
+		const int classes = dfa.classes.count;
+		
+		// the dead state is kept apart, so that it stays state 0, and the starting state 1
+		buffer<int> label;
+		for (std::size_t s = 0; s < dfa.states; ++s)
+			label.push_back( (s == 0) ? -1 : (dfa.accept[s] + 1) * 65536 + (dfa.alternative[s] + 1) );
+		
+		const auto block = impl::equivalent_states(dfa.states, classes, dfa.next, label);
+		
+		product_dfa res;
+		res.classes = dfa.classes;
+		
+		for (std::size_t s = 0; s < dfa.states; ++s)
+		{
+			if (block[s] != int(res.states))
+				continue;
+			
+			++res.states;
+			res.accept.push_back(dfa.accept[s]);
+			res.alternative.push_back(dfa.alternative[s]);
+			
+			for (int k = 0; k < classes; ++k)
+				res.next.push_back( block[ dfa.next[s * classes + k] ] );
+		}
+		return res;
+	}
+	
+	template <bool Minimal, auto... Matchers>
+	constexpr product_dfa build_dfa()
+	{
+		dfa_components c;
+		int idx = 0;
+		(impl::add_component(c, Matchers, idx++), ...);
+		
+		if constexpr (Minimal)
+			return impl::minimize( impl::build_product(c) );
+		else
+			return impl::build_product(c);
+	}
+	
+	template <std::size_t N>
+	using state_index_t = 
+		std::conditional_t< (N <= 0xFF), unsigned char, 
+		std::conditional_t< (N <= 0xFFFF), unsigned short, unsigned int> >;
+	
+	template <std::size_t N, std::size_t Classes>
+	struct dfa_table
+	{
+		using state_type = state_index_t<N>;
+		
+		static constexpr auto classes = Classes;
+		
+		unsigned char class_of[256];
+		state_type next[N * Classes];
+		short accept[N];
+		short alternative[N];
+		char_ranges loop[N]; // the characters on which each state loops back to itself
+		
+		constexpr auto get_next(std::size_t state, char c) const {
+			return next[state * Classes + class_of[static_cast<unsigned char>(c)]];
+		}
+	};
+	
+	template <std::size_t N, std::size_t Classes>
+	constexpr auto make_table(const product_dfa& dfa)
+	{
+		dfa_table<N, Classes> res{};
+		
+		for (int b = 0; b < 256; ++b)
+			res.class_of[b] = dfa.classes.of[b];
+		
+		for (std::size_t s = 0; s < N; ++s)
+		{
+			res.accept[s] = dfa.accept[s];
+			res.alternative[s] = dfa.alternative[s];
+			for (std::size_t k = 0; k < Classes; ++k)
+				res.next[s * Classes + k] = dfa.next[s * Classes + k];
+			
+			bool loops[256] {};
+			for (int b = 0; b < 256; ++b)
+				loops[b] = (s != 0) && dfa.next[s * Classes + dfa.classes.of[b]] == static_cast<int>(s);
+			res.loop[s] = char_ranges{loops};
+		}
+		return res;
+	}
+	
+	// The automaton of a set of matchers, flattened at compile-time, and minimized if Minimal
+	template <bool Minimal, auto... Matchers>
+	struct flat_dfa
+	{
+		static constexpr auto shape = impl::build_dfa<Minimal, Matchers...>().shape();
+		
+		static constexpr std::size_t states = shape.first;
+		static constexpr std::size_t classes = shape.second;
+		
+		static constexpr auto table = impl::make_table<states, classes>( impl::build_dfa<Minimal, Matchers...>() );
+	};
+	
+	template <auto... Matchers>
+	using static_dfa = flat_dfa<false, Matchers...>;
+	
+	// the case which matched (-1 if none), and the alternative of its matcher
+	struct accepted
+	{
+		int index = -1;
+		int alternative = -1;
+	};
+	
+	// call the action of the case which matched
+	template <class R, class Actions, std::size_t... Idx>
+	constexpr R invoke_case(accepted acc, Actions& actions, std::index_sequence<Idx...>)
+	{
+		using fn = R(*)(Actions&, int);
+		constexpr fn table[] = { 
+			[] (Actions& a, int alt) -> R { return impl::evaluate( impl::get<Idx>(a), alt ); }... 
+		};
+		return table[acc.index](actions, acc.alternative);
+	}
+	
+	// walk the table, and return the case that matched
+	template <class Dfa, bool FirstAccept = false, class Src, class Sent>
+	constexpr accepted table_run(Src& src, const Sent& end)
+	{
+		constexpr auto& table = Dfa::table;
+		
+		// stop at the first accepting state, nothing to save
+		if constexpr ( FirstAccept )
+		{
+			std::size_t state = 1;
+			
+			while (table.accept[state] == -1)
+			{
+				if constexpr ( not std::is_same_v<Sent, std::unreachable_sentinel_t> )
+				{
+					if (src == end)
+						return {};
+				}
+				
+				state = table.get_next(state, static_cast<char>(*src));
+				
+				if (state == 0)
+					return {};
+				
+				++src;
+			}
+			
+			return { table.accept[state], table.alternative[state] };
+		}
+		
+		std::size_t state = 1;
+		std::size_t accept_state = 0;
+		Src accepted_src = src;
+		
+		while (true)
+		{
+			if (table.accept[state] != -1)
+			{
+				accept_state = state;
+				accepted_src = src;
+			}
+			
+			if constexpr ( not std::is_same_v<Sent, std::unreachable_sentinel_t> )
+			{
+				if (src == end)
+					break;
+			}
+			
+			const std::size_t next = table.get_next(state, static_cast<char>(*src));
+			
+			if (next == 0)
+				break;
+			
+			++src;
+			
+			// a state which went back to itself is likely to stay there, skip the run at once
+			if (next == state && table.loop[state].count != 0)
+				src = impl::skip_ranges(table.loop[state], src, end);
+			
+			state = next;
+		}
+		
+		if (accept_state == 0)
+			return {};
+		
+		STRM_COUNT( if (probe) probe->backtrack = impl::count_between(accepted_src, src) )
+		
+		src = accepted_src;
+		return { table.accept[accept_state], table.alternative[accept_state] };
+	}
+	
+	template <class Dfa, std::size_t NumCases, bool FirstAccept, class Src, class Sent>
+	auto table_match(Src& src, const Sent& end, auto&& default_action, auto&& actions) -> decltype( default_action(src) )
+	{
+		using result = decltype( default_action(src) );
+		
+		STRM_COUNT( if (probe) *probe = {} )
+		
+		const auto accept = impl::table_run<Dfa, FirstAccept>(src, end);
+		
+		if (accept.index == -1)
+			return default_action(src);
+		
+		STRM_COUNT( if (probe) probe->index = accept.index )
+		
+		return impl::invoke_case<result>(accept, actions, std::make_index_sequence<NumCases>{});
+	}
+	
+	// ==================================================================
+	
+	// the characters on which a search stops : those which may begin a match, 
+	// and the zero byte which ends NUL-terminated inputs
+	struct byte_filter
+	{
+		static constexpr int max_reject = 16;
+		
+		bool stop[256] {};
+		unsigned char bytes[4] {}; // the characters of stop, if there are at most 4 of them
+		int count = 0;
+		
+		char reject[max_reject + 1] {}; // the characters of stop but 0, for strcspn, if there are at most 16 of them
+		int reject_count = 0;
+		
+		char_ranges skip; // the characters which aren't in stop, if they make a few ranges
+	};
+	
+	template <class Dfa, bool Terminated>
+	constexpr byte_filter make_filter()
+	{
+		constexpr auto& table = Dfa::table;
+		byte_filter res;
+		bool skip[256] {};
+		
+		for (int b = 0; b < 256; ++b)
+		{
+			// a case which matches the empty string matches anywhere
+			const bool first = table.accept[1] != -1 || table.get_next(1, static_cast<char>(b)) != 0;
+			
+			if (first || (Terminated && b == 0))
+			{
+				res.stop[b] = true;
+				if (res.count < 4) res.bytes[res.count] = b;
+				++res.count;
+				
+				if (b != 0 && res.reject_count <= byte_filter::max_reject)
+				{
+					if (res.reject_count < byte_filter::max_reject) res.reject[res.reject_count] = static_cast<char>(b);
+					++res.reject_count;
+				}
+			}
+			else
+			{
+				skip[b] = true;
+			}
+		}
+		
+		res.skip = char_ranges{skip};
+		return res;
+	}
+	
+	template <class Dfa, bool Terminated>
+	inline constexpr byte_filter filter_of = impl::make_filter<Dfa, Terminated>();
+	
+	// the high bit of the bytes of w which are equal to b (and maybe of some bytes after them)
+	constexpr std::uint64_t bytes_equal(std::uint64_t w, unsigned char b)
+	{
+		const auto x = w ^ (0x0101010101010101ull * b);
+		return (x - 0x0101010101010101ull) & ~x & 0x8080808080808080ull;
+	}
+	
+	// The first position of [src, end) whose character is in the filter, or end. 
+	// Contiguous inputs are scanned many characters at a time : 
+	// - of known size, with memchr, 8 characters at a time for up to 4 first bytes, 
+	//   or 16 to 64 at a time (SSE2/AVX2/AVX-512) when the other bytes make a few ranges, 
+	// - NUL-terminated, with strcspn for up to 16 first bytes, which never reads past the zero. 
+	// Other inputs and filters are read one character at a time.
+	template <const byte_filter& Filter, class Iter, class Sent>
+	Iter skip_to(Iter src, const Sent& end)
+	{
+		if constexpr ( contiguous_chars<Iter> && std::sized_sentinel_for<Sent, Iter> )
+		{
+			const char* first = std::to_address(src);
+			const char* last = first + (end - src);
+			
+			if constexpr ( Filter.count == 1 )
+			{
+				// memchr is vectorized by the C library
+				auto p = static_cast<const char*>( std::memchr(first, Filter.bytes[0], last - first) );
+				return src + ((p ? p : last) - first);
+			}
+			else if constexpr ( Filter.count <= 4 )
+			{
+				// 8 characters at a time, then the word with a hit one by one
+				auto p = first;
+				for (; last - p >= 8; p += 8)
+				{
+					std::uint64_t w;
+					std::memcpy(&w, p, 8);
+					
+					std::uint64_t hit = 0;
+					for (int k = 0; k < Filter.count; ++k)
+						hit |= impl::bytes_equal(w, Filter.bytes[k]);
+					
+					if (hit)
+						break;
+				}
+				
+				while (p != last && not Filter.stop[static_cast<unsigned char>(*p)]) 
+					++p;
+				return src + (p - first);
+			}
+			else if constexpr ( Filter.skip.count != 0 )
+			{
+				// stops on the first character out of the ranges, or less than 16 characters before last
+				auto p = impl::skip_ranges_simd(Filter.skip, first, last);
+				
+				while (p != last && not Filter.stop[static_cast<unsigned char>(*p)]) 
+					++p;
+				return src + (p - first);
+			}
+		}
+		else if constexpr ( contiguous_chars<Iter> && std::is_same_v<Sent, std::unreachable_sentinel_t> )
+		{
+			if constexpr ( Filter.reject_count <= byte_filter::max_reject )
+			{
+				// stops on the characters of reject, and on the zero at the end (which is in the filter)
+				const char* first = std::to_address(src);
+				return src + std::strcspn(first, Filter.reject);
+			}
+		}
+		
+		while (src != end && not Filter.stop[static_cast<unsigned char>(static_cast<char>(*src))])
+			++src;
+		return src;
+	}
+	
+	template <class Iter, class Sent>
+	constexpr bool at_end(const Iter& src, const Sent& end)
+	{
+		if constexpr ( std::is_same_v<Sent, std::unreachable_sentinel_t> )
+			return static_cast<char>(*src) == 0;
+		else
+			return src == end;
+	}
+	
+	// A matcher which may go on with a zero byte (e.g. re<".">), on inputs which aren't NUL-terminated
+	template <class Matcher>
+	inline constexpr bool reads_zero = false;
+	
+	// The end of a NUL-terminated input, for the matchers which read zero bytes : the engine compares 
+	// its position with it before reading each character, so it stops at the zero.
+	struct nul_end
+	{
+		template <class Iter>
+		friend constexpr bool operator == (const Iter& it, const nul_end&) { return static_cast<char>(*it) == 0; }
+	};
+	
+	// The other matchers never go past the zero, nothing to compare
+	template <class... Matchers>
+	constexpr auto terminator()
+	{
+		if constexpr ( (reads_zero<Matchers> || ...) )
+			return nul_end{};
+		else
+			return std::unreachable_sentinel;
+	}
+	
+	// a match found by a search : the case, and the input [begin, end) it matched
+	template <class Iter>
+	struct search_hit
+	{
+		accepted acc;
+		Iter begin, end;
+	};
+	
+	// Unanchored search : the leftmost match, and the longest from there, i.e. the result of match 
+	// at the first position where it succeeds. As in Aho-Corasick, the automaton runs from every 
+	// position at once : the active runs are kept, one for each state, from the leftmost position 
+	// which reached it (their futures are the same), so the input is read only once.
+	template <class Dfa, class Iter>
+	struct searcher
+	{
+		struct run
+		{
+			std::size_t state = 0;
+			Iter start {};
+		};
+		
+		template <class Sent>
+		search_hit<Iter> find(Iter src, const Sent& end)
+		{
+			constexpr auto& table = Dfa::table;
+			constexpr auto& filter = filter_of<Dfa, std::is_same_v<Sent, std::unreachable_sentinel_t>>;
+			
+			search_hit<Iter> best{ {}, src, src };
+			std::size_t count = 0;
+			
+			// the stamps of the previous find don't hold for this one
+			++step;
+			
+			while (true)
+			{
+				// once a match is found, the runs which start after it can't win
+				if (best.acc.index == -1)
+				{
+					// skip the characters which can't begin a match
+					if (count == 0)
+						src = impl::skip_to<filter>(src, end);
+					
+					if (seen[1] != step)
+					{
+						seen[1] = step;
+						runs[count++] = { 1, src };
+					}
+				}
+				
+				// the runs are sorted by start, so the first one in an accepting state is the leftmost, 
+				// and the longest one from its start since it's the furthest
+				for (std::size_t k = 0; k < count; ++k)
+				{
+					if (table.accept[runs[k].state] != -1)
+					{
+						best = { { table.accept[runs[k].state], table.alternative[runs[k].state] }, runs[k].start, src };
+						count = k + 1;
+						break;
+					}
+				}
+				
+				if (count == 0 || impl::at_end(src, end))
+					break;
+				
+				++step;
+				std::size_t n = 0;
+				const char c = static_cast<char>(*src);
+				
+				for (std::size_t k = 0; k < count; ++k)
+				{
+					const std::size_t s = table.get_next(runs[k].state, c);
+					if (s != 0 && seen[s] != step)
+					{
+						seen[s] = step;
+						next[n++] = { s, runs[k].start };
+					}
+				}
+				
+				std::swap(runs, next);
+				count = n;
+				++src;
+			}
+			
+			if (best.acc.index == -1)
+				best.begin = best.end = src;
+			return best;
+		}
+		
+		buffer<run> runs{Dfa::states}, next{Dfa::states};
+		buffer<std::size_t> seen{Dfa::states, 0};
+		std::size_t step = 1;
+	};
+	
+	// ==================================================================
+	
+	template <class... Options>
+	struct options {};
+	
+	template <class Opt, class... Options>
+	inline constexpr bool has_option = (std::is_same_v<Opt, Options> || ...);
+	
+	template <class... Options>
+	struct profile_of { using type = no_profile; };
+	
+	template <class Head, class... Tail>
+	struct profile_of<Head, Tail...> : profile_of<Tail...> {};
+	
+	template <byte_weights Weights, class... Tail>
+	struct profile_of<byte_profile<Weights>, Tail...> { using type = byte_profile<Weights>; };
+	
+	template <int Idx>
+	struct index_action {
+		constexpr accepted operator()(int alternative) const { return {Idx, alternative}; }
+	};
+	
+	template <std::size_t... Idx>
+	constexpr auto make_index_actions(std::index_sequence<Idx...>) {
+		return impl::tuple< index_action<Idx>... >{};
+	}
+	
+	// The automaton of a set of matchers, run with the backend selected by the options.
+	// Returns the index of the matcher which matched (-1 if none did), and its alternative.
+	template <class Options, class... Matchers>
+	struct automaton;
+	
+	template <class... Options, class... Matchers>
+	struct automaton<options<Options...>, Matchers...>
+	{
+		template <class Iter, class Sent>
+		static constexpr accepted run(Iter& src, const Sent& end)
+		{
+			if constexpr ( has_option<table_backend, Options...> )
+			{
+				return impl::table_run
+				<
+				 impl::flat_dfa< has_option<minimize_states, Options...>, Matchers{}... >,
+				 has_option<first_accept, Options...>
+				>
+				(src, end);
+			}
+			else
+			{
+				return impl::match_impl
+				<
+				 impl::make_matchers_list<Matchers...>,
+				 has_option<first_accept, Options...>,
+				 typename profile_of<Options...>::type
+				>
+				(src,
+				 end,
+				 impl::default_case{ accepted{} },
+				 impl::make_index_actions( std::make_index_sequence<sizeof...(Matchers)>{} )
+				);
+			}
+		}
+	};
+	
+	// ==================================================================
+
+} // IMPL 
+
+template <class It>
+concept stream = requires (It& it) { 
+	++it;
+	char(*it); 
+};
+
+template <class S, class It>
+concept sentinel_for = requires (const It& it, const S& s) {
+	bool(it == s);
+};
+
+///
+/// The result of a case, and the input it matched
+///
+template <class Result, class Iter>
+struct match_result
+{
+	Result result;
+	Iter begin;
+	Iter end;
+	
+	// the matched text, for contiguous inputs
+	constexpr std::string_view text() const requires impl::contiguous_chars<Iter> {
+		return impl::lexeme(begin, end);
+	}
+};
+
+namespace impl {
+	
+	template <class T>
+	inline constexpr bool is_case = false;
+	
+	template <class M, class R>
+	inline constexpr bool is_case<case_<M, R>> = true;
+	
+	template <class... Matchers>
+	inline constexpr char cases_id = 0;
+	
+	// reports the match to the counter_sink once it's done
+	template <class Iter>
+	struct match_recorder
+	{
+		constexpr match_recorder(const void* cases, const Iter& first, const Iter& src) 
+		: cases{cases}, first{first}, src{src}
+		{
+			STRM_COUNT( previous = probe; probe = &state )
+		}
+		
+		constexpr ~match_recorder()
+		{
+			STRM_COUNT( 
+				probe = previous; 
+				if (sink) sink->record({ cases, state.index, impl::count_between(first, src), state.backtrack }) 
+			)
+		}
+		
+		const void* cases;
+		const Iter& first;
+		const Iter& src;
+		match_probe state;
+		match_probe* previous = nullptr;
+	};
+	
+	// reports a match whose outcome is only known at its end, with no probe filled on the way
+	template <class... Matchers>
+	constexpr void record_match([[maybe_unused]] int index, [[maybe_unused]] std::size_t length, [[maybe_unused]] std::size_t backtrack)
+	{
+		STRM_COUNT( if (sink) sink->record({ &cases_id<Matchers...>, index, length, backtrack }) )
+	}
+	
+	// match from first, where src is
+	template <class... Options, class Iter, class Sent, class Default, class... Cases>
+	constexpr decltype(auto) match_from(const Iter& first, Iter& src, const Sent& end, Default&& default_, Cases... cases)
+	{
+		#ifdef STRM_COUNTERS
+		const match_recorder<Iter> recorder{ &cases_id<typename Cases::matcher...>, first, src };
+		#endif
+		
+		if constexpr ( has_option<table_backend, Options...> )
+		{
+			return impl::table_match
+			<
+			 impl::flat_dfa< has_option<minimize_states, Options...>, typename Cases::matcher{}... >,
+			 sizeof...(Cases),
+			 has_option<first_accept, Options...>
+			>
+			(src,
+			 end,
+			 impl::default_case{ default_ },
+			 impl::tuple{ impl::bind_action<typename Cases::matcher>(cases.result, first, src)... }
+			);
+		}
+		else
+		{
+			return impl::match_impl
+			< 
+			 impl::make_matchers_list< typename Cases::matcher... >,
+			 has_option<first_accept, Options...>,
+			 typename profile_of<Options...>::type
+			>
+			(src,
+			 end,
+			 impl::default_case{ default_ },
+			 impl::tuple{ impl::bind_action<typename Cases::matcher>(cases.result, first, src)... }
+			);
+		}
+	}
+	
+	template <class... Options, class Iter, class Sent, class Default, class... Cases>
+	constexpr decltype(auto) match(Iter& src, const Sent& end, Default&& default_, Cases... cases)
+	{
+		const Iter first = src;
+		return impl::match_from<Options...>(first, src, end, STRM_FWD(default_), cases...);
+	}
+	
+	template <class... Options, class Iter, class Sent, class Default, class... Cases>
+	constexpr auto match_span(Iter& src, const Sent& end, Default&& default_, Cases... cases)
+	{
+		const Iter first = src;
+		auto&& res = impl::match_from<Options...>(first, src, end, STRM_FWD(default_), cases...);
+		return match_result< std::decay_t<decltype(res)>, Iter >{ STRM_FWD(res), first, src };
+	}
+	
+} // IMPL
+
+///
+/// Match a NUL-terminated input
+///
+template <class... Options, stream Iter, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr decltype(auto) match(Iter& src, Default&& default_, Cases... cases)
+{
+	return impl::match<Options...>(src, impl::terminator<typename Cases::matcher...>(), STRM_FWD(default_), cases...);
+}
+
+///
+/// Match the range [src, end), the input doesn't need to be terminated 
+/// and may contain zero bytes
+///
+template <class... Options, stream Iter, sentinel_for<Iter> Sent, class Default, class... Cases>
+	requires (not impl::is_case<std::remove_cvref_t<Default>>) && (impl::is_case<Cases> && ...)
+constexpr decltype(auto) match(Iter& src, Sent end, Default&& default_, Cases... cases)
+{
+	return impl::match<Options...>(src, end, STRM_FWD(default_), cases...);
+}
+
+///
+/// Match the beginning of a string_view, and remove the consumed characters from it
+///
+template <class... Options, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr auto match(std::string_view& src, Default&& default_, Cases... cases)
+{
+	auto it = src.data();
+	auto res = impl::match<Options...>(it, src.data() + src.size(), STRM_FWD(default_), cases...);
+	src.remove_prefix(it - src.data());
+	return res;
+}
+
+///
+/// Match the beginning of a UTF-8 string, and remove the consumed characters from it
+///
+template <class... Options, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr auto match(std::u8string_view& src, Default&& default_, Cases... cases)
+{
+	auto it = src.data();
+	auto res = impl::match<Options...>(it, src.data() + src.size(), STRM_FWD(default_), cases...);
+	src.remove_prefix(it - src.data());
+	return res;
+}
+
+///
+/// Like match, but also returns the span of input which was matched, as a match_result
+///
+template <class... Options, stream Iter, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr auto match_span(Iter& src, Default&& default_, Cases... cases)
+{
+	return impl::match_span<Options...>(src, impl::terminator<typename Cases::matcher...>(), STRM_FWD(default_), cases...);
+}
+
+template <class... Options, stream Iter, sentinel_for<Iter> Sent, class Default, class... Cases>
+	requires (not impl::is_case<std::remove_cvref_t<Default>>) && (impl::is_case<Cases> && ...)
+constexpr auto match_span(Iter& src, Sent end, Default&& default_, Cases... cases)
+{
+	return impl::match_span<Options...>(src, end, STRM_FWD(default_), cases...);
+}
+
+template <class... Options, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr auto match_span(std::string_view& src, Default&& default_, Cases... cases)
+{
+	auto it = src.data();
+	auto res = impl::match_span<Options...>(it, src.data() + src.size(), STRM_FWD(default_), cases...);
+	src.remove_prefix(it - src.data());
+	return res;
+}
+
+namespace impl {
+	
+	template <class Actions, std::size_t... Idx>
+	auto common_result(Actions& a, std::index_sequence<Idx...>) 
+		-> std::common_type_t< std::decay_t<decltype( impl::evaluate(impl::get<Idx>(a)) )>... >;
+	
+	template <class... Options, class Iter, class Sent, class Default, class... Cases>
+	auto search(Iter& src, const Sent& end, Default&& default_, Cases... cases)
+	{
+		using dfa = impl::flat_dfa< has_option<minimize_states, Options...>, typename Cases::matcher{}... >;
+		
+		const auto hit = impl::searcher<dfa, Iter>{}.find(src, end);
+		
+		const Iter first = hit.begin;
+		src = hit.end;
+		
+		#ifdef STRM_COUNTERS
+		match_recorder<Iter> recorder{ &cases_id<typename Cases::matcher...>, first, src };
+		recorder.state.index = hit.acc.index;
+		#endif
+		
+		impl::default_case default_action{ default_ };
+		auto actions = impl::tuple{ impl::bind_action<typename Cases::matcher>(cases.result, first, src)... };
+		
+		using result = std::decay_t<decltype( default_action(src) )>;
+		
+		if (hit.acc.index == -1)
+			return match_result<result, Iter>{ default_action(src), first, src };
+		
+		return match_result<result, Iter>{ 
+			impl::invoke_case<result>(hit.acc, actions, std::make_index_sequence<sizeof...(Cases)>{}), first, src 
+		};
+	}
+	
+	template <class... Options, class Iter, class Sent, class F, class... Cases>
+	void find_all(Iter src, const Sent& end, F& f, Cases... cases)
+	{
+		using dfa = impl::flat_dfa< has_option<minimize_states, Options...>, typename Cases::matcher{}... >;
+		constexpr auto cases_seq = std::make_index_sequence<sizeof...(Cases)>{};
+		
+		Iter first = src, last = src;
+		auto actions = impl::tuple{ impl::bind_action<typename Cases::matcher>(cases.result, first, last)... };
+		
+		using result = decltype( impl::common_result(actions, cases_seq) );
+		
+		auto report = [&] (accepted acc) {
+			#ifdef STRM_COUNTERS
+			match_recorder<Iter> recorder{ &cases_id<typename Cases::matcher...>, first, last };
+			recorder.state.index = acc.index;
+			#endif
+			
+			f( match_result<result, Iter>{ impl::invoke_case<result>(acc, actions, cases_seq), first, last } );
+		};
+		
+		if constexpr ( has_option<overlapping, Options...> )
+		{
+			constexpr auto& filter = filter_of<dfa, std::is_same_v<Sent, std::unreachable_sentinel_t>>;
+			
+			// match at every position which may begin a match
+			while (true)
+			{
+				first = impl::skip_to<filter>(first, end);
+				last = first;
+				
+				const auto acc = impl::table_run<dfa>(last, end);
+				if (acc.index != -1)
+					report(acc);
+				
+				if (impl::at_end(first, end))
+					break;
+				++first;
+			}
+		}
 		else
-			return current_action(src);
+		{
+			impl::searcher<dfa, Iter> s;
+			
+			while (true)
+			{
+				const auto hit = s.find(src, end);
+				if (hit.acc.index == -1)
+					break;
+				
+				first = hit.begin;
+				last = src = hit.end;
+				report(hit.acc);
+				
+				// an empty match resumes after it
+				if (first == last)
+				{
+					if (impl::at_end(src, end))
+						break;
+					++src;
+				}
+			}
+		}
+	}
 	
-		#undef M
-		#undef IMPL
+} // IMPL
+
+///
+/// Find the first match of the cases in a NUL-terminated input : the leftmost position where match 
+/// would succeed, and the longest match from there, as a match_result. src is moved to the end of 
+/// the match, or of the input if nothing matched (the result is then the default). 
+/// The automaton runs from every position at once, so the input is read only once, 
+/// and the characters which can't begin a match are skipped several at a time. 
+/// The automaton is flattened as with the table backend (strm::minimize_states applies).
+///
+template <class... Options, stream Iter, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+auto search(Iter& src, Default&& default_, Cases... cases)
+{
+	return impl::search<Options...>(src, impl::terminator<typename Cases::matcher...>(), STRM_FWD(default_), cases...);
+}
+
+template <class... Options, stream Iter, sentinel_for<Iter> Sent, class Default, class... Cases>
+	requires (not impl::is_case<std::remove_cvref_t<Default>>) && (impl::is_case<Cases> && ...)
+auto search(Iter& src, Sent end, Default&& default_, Cases... cases)
+{
+	return impl::search<Options...>(src, end, STRM_FWD(default_), cases...);
+}
+
+template <class... Options, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+auto search(std::string_view& src, Default&& default_, Cases... cases)
+{
+	auto it = src.data();
+	auto res = impl::search<Options...>(it, src.data() + src.size(), STRM_FWD(default_), cases...);
+	src.remove_prefix(it - src.data());
+	return res;
+}
+
+///
+/// Call f with the match_result of every match of the cases in a NUL-terminated input, from left to right. 
+/// Each search resumes at the end of the previous match; with strm::overlapping, 
+/// every position where match would succeed is reported instead.
+///
+template <class... Options, stream Iter, class F, class... Cases>
+	requires (not impl::is_case<std::remove_cvref_t<F>>) && (impl::is_case<Cases> && ...)
+void find_all(Iter src, F&& f, Cases... cases)
+{
+	impl::find_all<Options...>(src, impl::terminator<typename Cases::matcher...>(), f, cases...);
+}
+
+template <class... Options, stream Iter, sentinel_for<Iter> Sent, class F, class... Cases>
+	requires (not impl::is_case<std::remove_cvref_t<F>>) && (impl::is_case<Cases> && ...)
+void find_all(Iter src, Sent end, F&& f, Cases... cases)
+{
+	impl::find_all<Options...>(src, end, f, cases...);
+}
+
+template <class... Options, class F, class... Cases>
+	requires (not impl::is_case<std::remove_cvref_t<F>>) && (impl::is_case<Cases> && ...)
+void find_all(std::string_view src, F&& f, Cases... cases)
+{
+	impl::find_all<Options...>(src.data(), src.data() + src.size(), f, cases...);
+}
+
+namespace impl {
+	
+	// the number of inputs match_batch runs at once
+	inline constexpr std::size_t batch_lanes = 4;
+	
+	// an input of match_batch, being matched
+	struct batch_lane
+	{
+		std::size_t input = 0;
+		std::size_t state = 0;
+		const char* src = nullptr;
+		const char* end = nullptr;
+	};
+	
+	template <class... Options, class Out, class Default, class... Cases>
+	Out match_batch(std::span<std::string_view> inputs, Out out, Default&& default_, Cases... cases)
+	{
+		using dfa = impl::flat_dfa< has_option<minimize_states, Options...>, typename Cases::matcher{}... >;
+		constexpr auto& table = dfa::table;
+		constexpr bool stop_on_accept = has_option<first_accept, Options...>;
+		
+		const char* first = nullptr;
+		const char* last = nullptr;
+		
+		impl::default_case default_action{ default_ };
+		auto actions = impl::tuple{ impl::bind_action<typename Cases::matcher>(cases.result, first, last)... };
+		
+		using result = decltype( default_action(last) );
+		
+		std::size_t next_input = 0;
+		std::size_t idle = 0;
+		
+		auto start = [&] (batch_lane& l) {
+			if (next_input == inputs.size())
+			{
+				l = { inputs.size(), 0, nullptr, nullptr };
+				++idle;
+				return;
+			}
+			
+			const auto sv = inputs[next_input];
+			l = { next_input++, 1, sv.data(), sv.data() + sv.size() };
+		};
+		
+		// A lane stops in the last state it reached. Most often it accepts there, 
+		// otherwise the input is matched again, to fall back to the last accepting position.
+		auto finish = [&] (batch_lane& l) {
+			auto& in = inputs[l.input];
+			first = in.data();
+			last = l.src;
+			
+			// where the automaton stopped, for the counters
+			[[maybe_unused]] const char* const stop = l.src;
+			
+			accepted acc{ table.accept[l.state], table.alternative[l.state] };
+			
+			if (acc.index == -1)
+			{
+				last = first;
+				acc = impl::table_run<dfa, stop_on_accept>(last, in.data() + in.size());
+			}
+			
+			// as with match, the characters read are consumed when no case matched
+			in.remove_prefix(last - first);
+			
+			if (acc.index == -1)
+				out[l.input] = default_action(last);
+			else
+				out[l.input] = impl::invoke_case<result>(acc, actions, std::make_index_sequence<sizeof...(Cases)>{});
+			
+			impl::record_match<typename Cases::matcher...>(acc.index, last - first, (acc.index == -1) ? 0 : stop - last);
+			
+			start(l);
+		};
+		
+		// Each lane takes a step in turn. Their transitions don't depend on each other, 
+		// so the loads and the branches of several inputs are in flight at once.
+		// A lane which can't go further is done at its next turn, where it takes the next input.
+		auto step = [&] (batch_lane& l) {
+			if (l.src != l.end && (not stop_on_accept || table.accept[l.state] == -1)) [[likely]]
+			{
+				const std::size_t next = table.get_next(l.state, static_cast<char>(*l.src));
+				
+				if (next != 0) [[likely]]
+				{
+					l.state = next;
+					++l.src;
+				}
+				else
+					l.end = l.src;
+			}
+			else if (l.input != inputs.size())
+				finish(l);
+		};
+		
+		[&] <std::size_t... K> (std::index_sequence<K...>) {
+			batch_lane lanes[batch_lanes];
+			(start(lanes[K]), ...);
+			
+			while (idle != batch_lanes)
+				(step(lanes[K]), ...);
+		}(std::make_index_sequence<batch_lanes>{});
+		
+		return out + inputs.size();
 	}
+	
+} // IMPL
 
-	#undef REP5
-	#undef REP10
-	#undef REP15
-	#undef REP30
-	#undef REP50
-	#undef REP100
-	#undef REP255
+///
+/// Match the beginning of many short, independent inputs (fields, header values...),
+/// and remove the consumed characters from each of them. The result of input k is written to out[k],
+/// as match would return it. The automaton is flattened as with the table backend,
+/// and runs over several inputs at once, interleaved in the same thread.
+/// Returns the end of the results.
+///
+template <class... Options, std::random_access_iterator Out, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+Out match_batch(std::span<std::string_view> inputs, Out out, Default&& default_, Cases... cases)
+{
+	return impl::match_batch<Options...>(inputs, out, STRM_FWD(default_), cases...);
+}
+
+///
+/// A single-pass input (e.g. std::istreambuf_iterator), matched with a lookahead of at most K characters. 
+/// The iterator is never copied : the characters read past the end of a match are kept in a ring buffer, 
+/// and read again by the next match. 
+/// 
+/// The automaton gives up K characters past its last accepting position, so a longer match 
+/// which needs more lookahead than that isn't found. Tokens themselves can be of any length.
+///
+template <std::size_t K, stream Iter, sentinel_for<Iter> Sent = Iter>
+class lookahead_input
+{
+	static_assert( K > 0, "the lookahead must hold at least one character" );
 	
-	// ==================================================================
+	public : 
+	
+	constexpr lookahead_input(Iter it, Sent end) : it_{std::move(it)}, end_{std::move(end)} {}
+	
+	// every character of the input was consumed
+	constexpr bool empty() const { return size_ == 0 && it_ == end_; }
+	
+	// number of characters read ahead, and not consumed yet
+	constexpr std::size_t buffered() const { return size_; }
+	
+	// Walk the table of Dfa from the next character, and return the case that matched. 
+	// The matched characters are consumed, or the characters read if no case matched, like with match().
+	template <class Dfa, bool FirstAccept>
+	constexpr impl::accepted run()
+	{
+		constexpr auto& table = Dfa::table;
+		
+		std::size_t state = 1;
+		impl::accepted res{ table.accept[1], table.alternative[1] };
+		
+		// the characters read past the last accepting position are the first ones of the buffer, 
+		// those before it, or read while no case accepted, are consumed right away
+		std::size_t read = 0;
+		
+		while (not (FirstAccept && res.index != -1))
+		{
+			if (read == size_)
+			{
+				if (size_ == K || it_ == end_)
+					break;
+				
+				ring_[(head_ + size_) % K] = static_cast<char>(*it_);
+				++it_;
+				++size_;
+			}
+			
+			state = table.get_next(state, ring_[(head_ + read) % K]);
+			
+			if (state == 0)
+				break;
+			
+			++read;
+			
+			if (table.accept[state] != -1)
+				res = { table.accept[state], table.alternative[state] };
+			
+			if (table.accept[state] != -1 || res.index == -1)
+			{
+				consume(read);
+				read = 0;
+			}
+		}
+		
+		return res;
+	}
+	
+	private : 
+	
+	constexpr void consume(std::size_t n)
+	{
+		head_ = (head_ + n) % K;
+		size_ -= n;
+	}
+	
+	Iter it_;
+	Sent end_;
+	
+	char ring_[K] = {};
+	std::size_t head_ = 0;
+	std::size_t size_ = 0;
+};
 
-} // IMPL 
+///
+/// Match the next characters of a lookahead_input. 
+/// Since it walks the input one character at a time, this always runs the table backend.
+///
+template <class... Options, std::size_t K, class Iter, class Sent, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr decltype(auto) match(lookahead_input<K, Iter, Sent>& src, Default&& default_, Cases... cases)
+{
+	static_assert( not (impl::classifies<typename Cases::matcher> || ...), 
+		"the characters of a lookahead_input aren't kept, they can't be classified" );
+	
+	static_assert( not (impl::takes_value<typename Cases::matcher, decltype(Cases::result), Iter> || ...), 
+		"the characters of a lookahead_input aren't kept, their value can't be computed" );
+	
+	using dfa = impl::flat_dfa< impl::has_option<minimize_states, Options...>, typename Cases::matcher{}... >;
+	
+	auto default_action = impl::default_case{ default_ };
+	auto actions = impl::tuple{ cases.result... };
+	
+	using result = decltype( default_action(src) );
+	
+	const auto accept = src.template run< dfa, impl::has_option<first_accept, Options...> >();
+	
+	if (accept.index == -1)
+		return default_action(src);
+	
+	return impl::invoke_case<result>(accept, actions, std::index_sequence_for<Cases...>{});
+}
 
-template <class It>
-concept stream = requires (It& it) { 
-	++it;
-	char(*it); 
+// ==================================================================
+// tokenizer
+
+template <class Kind>
+struct token
+{
+	Kind kind;
+	std::size_t offset;
+	std::size_t length;
 };
 
-template <stream Iter, class Default, class... Cases>
-constexpr decltype(auto) match(Iter& src, Default&& default_, Cases... cases)
+template <class Options, matcher Skip, class Default, class... Cases>
+struct tokenizer;
+
+///
+/// Runs the automaton of a set of cases repeatedly over a buffer, and writes the tokens into a batch.
+/// The skip pattern (e.g. whitespace) is part of the automaton, with the lowest priority. 
+/// A character which starts no token is written as a token of the default kind.
+///
+template <class... Options, matcher Skip, class Default, class... Cases>
+struct tokenizer<impl::options<Options...>, Skip, Default, Cases...>
+{
+	using kind_type  = std::decay_t<decltype( impl::evaluate(std::declval<Default&>()) )>;
+	using token_type = token<kind_type>;
+	
+	static constexpr int skip_index = sizeof...(Cases);
+	
+	using automaton = impl::automaton< 
+		impl::options<Options...>, 
+		typename Cases::matcher..., 
+		Skip 
+	>;
+	
+	// Lex input from pos, until the end of input or until out is full. 
+	// Returns the number of tokens written, pos is moved past them.
+	constexpr std::size_t operator()(std::string_view input, std::size_t& pos, std::span<token_type> out)
+	{
+		const char* const first = input.data();
+		const char* const last  = first + input.size();
+		const char* it = first + pos;
+		
+		std::size_t count = 0;
+		
+		while (count != out.size() && it != last)
+		{
+			const char* const start = it;
+			
+			#ifdef STRM_COUNTERS
+			impl::match_recorder<const char*> recorder{ &impl::cases_id<typename Cases::matcher..., Skip>, start, it };
+			#endif
+			
+			auto acc = automaton::run(it, last);
+			
+			STRM_COUNT( recorder.state.index = (it == start) ? -1 : acc.index )
+			
+			if (acc.index == skip_index && it != start)
+				continue;
+			
+			// don't get stuck on empty matches
+			if (it == start)
+			{
+				acc = {};
+				++it;
+			}
+			
+			acc.alternative = impl::classify<typename Cases::matcher...>(acc.index, acc.alternative, start, it);
+			
+			out[count++] = token_type{ kind(acc), std::size_t(start - first), std::size_t(it - start) };
+		}
+		
+		pos = it - first;
+		return count;
+	}
+	
+	constexpr kind_type kind(impl::accepted acc)
+	{
+		if (acc.index == -1)
+			return impl::evaluate(default_);
+		
+		return impl::invoke_case<kind_type>(acc, results, std::index_sequence_for<Cases...>{});
+	}
+	
+	Default default_;
+	impl::tuple<decltype(Cases::result)...> results;
+};
+
+template <class... Options, matcher Skip, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr auto make_tokenizer(Skip, Default default_, Cases... cases)
+{
+	return tokenizer<impl::options<Options...>, Skip, Default, Cases...>{ default_, {cases.result...} };
+}
+
+///
+/// Lex a buffer into a batch of tokens, see tokenizer
+///
+template <class Options, class Skip, class Default, class... Cases>
+constexpr std::size_t tokenize(
+	tokenizer<Options, Skip, Default, Cases...>& lexer, 
+	std::string_view input, 
+	std::size_t& pos, 
+	std::span<typename tokenizer<Options, Skip, Default, Cases...>::token_type> out)
+{
+	return lexer(input, pos, out);
+}
+
+// ==================================================================
+// resumable matching
+
+///
+/// The state of a match suspended at the end of a buffer. 
+/// It is trivially copyable, and may be saved and restored as is.
+///
+struct match_state
+{
+	// state of the automaton, 0 once no case can match anymore
+	std::uint32_t state = 1;
+	
+	// the last case which matched, -1 if none
+	int accept = -1;
+	
+	// and the alternative of its matcher
+	int alternative = -1;
+	
+	// length of the input matched by accept
+	std::size_t length = 0;
+	
+	// number of characters read past it
+	std::size_t pending = 0;
+	
+	constexpr bool operator==(const match_state&) const = default;
+};
+
+template <class Options, class Default, class... Cases>
+struct resumable_matcher;
+
+///
+/// Match an input which arrives in several buffers, without copying them together. 
+/// feed() consumes a buffer and returns nothing until the match is complete, 
+/// the progress in between is kept in a match_state. 
+/// 
+/// Since the state of the automaton must be stored, this always runs the table backend.
+///
+template <class... Options, class Default, class... Cases>
+struct resumable_matcher<impl::options<Options...>, Default, Cases...>
 {
-	using def_case = impl::default_case<std::decay_t<Default&&>>;
+	using result_type = std::decay_t<decltype( impl::evaluate(std::declval<Default&>()) )>;
+	using dfa = impl::flat_dfa< impl::has_option<minimize_states, Options...>, typename Cases::matcher{}... >;
+	
+	static_assert( not (impl::classifies<typename Cases::matcher> || ...), 
+		"the input of a resumable match isn't contiguous, it can't be classified" );
+	
+	static_assert( not (impl::takes_value<typename Cases::matcher, decltype(Cases::result), const char*> || ...), 
+		"the input of a resumable match isn't contiguous, its value can't be computed" );
+	
+	static constexpr match_state initial_state() {
+		return match_state{ 1, dfa::table.accept[1], dfa::table.alternative[1], 0, 0 };
+	}
+	
+	// Feed the next buffer of input. 
+	// If the match completes in it, returns the result and chunk is advanced past the matched characters, 
+	// otherwise the whole chunk was consumed.
+	constexpr std::optional<result_type> feed(std::string_view& chunk)
+	{
+		constexpr auto& table = dfa::table;
+		
+		replay = 0;
+		
+		for (std::size_t k = 0; k != chunk.size(); ++k)
+		{
+			const auto next = table.get_next(state.state, chunk[k]);
+			
+			if (next == 0)
+			{
+				state.state = 0;
+				return complete(chunk, k);
+			}
+			
+			state.state = next;
+			++state.pending;
+			
+			if (table.accept[next] != -1)
+			{
+				state.accept = table.accept[next];
+				state.alternative = table.alternative[next];
+				state.length += state.pending;
+				state.pending = 0;
+			}
+			
+			if constexpr ( impl::has_option<first_accept, Options...> )
+			{
+				if (state.accept != -1)
+					return complete(chunk, k + 1);
+			}
+		}
+		
+		chunk = {};
+		return std::nullopt;
+	}
+	
+	// Signal the end of input, and return the result
+	constexpr result_type finish()
+	{
+		std::string_view none;
+		return complete(none, 0);
+	}
+	
+	constexpr void reset() {
+		state = initial_state();
+		replay = 0;
+	}
+	
+	match_state state = initial_state();
+	
+	// the length of the last match
+	std::size_t length = 0;
+	
+	// when a match ends in a previous buffer, the number of characters of the previous buffers
+	// which were read past it, and must be fed again before the current one
+	std::size_t replay = 0;
+	
+	Default default_;
+	impl::tuple<decltype(Cases::result)...> results;
+	
+	private : 
+	
+	// when no case matched, the input is left where the automaton stopped, like with match()
+	constexpr result_type complete(std::string_view& chunk, std::size_t consumed)
+	{
+		const impl::accepted accept{ state.accept, state.alternative };
+		
+		if (accept.index == -1)
+		{
+			length = state.length + state.pending;
+			chunk.remove_prefix(consumed);
+		}
+		else
+		{
+			length = state.length;
+			
+			if (state.pending <= consumed)
+				chunk.remove_prefix(consumed - state.pending);
+			else
+				replay = state.pending - consumed;
+		}
+		
+		impl::record_match<typename Cases::matcher...>(accept.index, length, (accept.index == -1) ? 0 : state.pending);
+		
+		state = initial_state();
+		
+		if (accept.index == -1)
+			return impl::evaluate(default_);
 		
-	return match_impl
-	< 
-	 impl::make_matchers_list< typename Cases::matcher... >
-	>
-	(src,
-	 impl::default_case{ default_ },
-	 impl::tuple{cases.result...}
-	);
+		return impl::invoke_case<result_type>(accept, results, std::index_sequence_for<Cases...>{});
+	}
+};
+
+template <class... Options, class Default, class... Cases>
+	requires (impl::is_case<Cases> && ...)
+constexpr auto make_resumable(Default default_, Cases... cases)
+{
+	return resumable_matcher<impl::options<Options...>, Default, Cases...>{ .default_ = default_, .results = {cases.result...} };
 }
 
 } // STRM
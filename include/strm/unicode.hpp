@@ -0,0 +1,95 @@
+#ifndef STRM_CPP_LIBRARY_UNICODE_HEADER
+#define STRM_CPP_LIBRARY_UNICODE_HEADER
+
+#include "strm.hpp"
+#include "unicode_tables.hpp"
+
+namespace strm {
+
+///
+/// A Unicode identifier in UTF-8 : a XID_Start character or '_', followed by XID_Continue characters.
+/// It reads the bytes directly, the input isn't decoded : its states are those of a byte-level automaton 
+/// (see unicode_tables.hpp), and a malformed sequence stops the match before it, like any other character.
+///
+struct utf8_identifier_matcher {
+	
+	static constexpr int match_ = -2;
+	static constexpr int fail_  = -1;
+	
+	static constexpr int states = impl::xid::states;
+	
+	using Self = utf8_identifier_matcher;
+	
+	constexpr auto status() const {
+		switch(state_) { case match_ : return matched; case fail_ : return failed; default : return running; }
+	}
+	
+	constexpr auto get_next(char C) const
+	{
+		if (state_ < 0)
+			return *this;
+		
+		const auto b = static_cast<unsigned char>(C);
+		
+		for (int k = impl::xid::first[state_]; k != impl::xid::first[state_ + 1]; ++k)
+		{
+			const auto& r = impl::xid::runs[k];
+			if (r.lo <= b && b <= r.hi)
+				return Self{ r.next };
+		}
+		return Self{ (state_ == 1) ? match_ : fail_ };
+	}
+	
+	// the runs are ordered as unsigned bytes, the range is that of chars
+	constexpr char min() const 
+	{
+		int res = std::numeric_limits<char>::max();
+		for_each_byte([&] (int c) { res = (c < res) ? c : res; });
+		return static_cast<char>(res);
+	}
+	
+	constexpr char max() const 
+	{
+		int res = std::numeric_limits<char>::min();
+		for_each_byte([&] (int c) { res = (c > res) ? c : res; });
+		return static_cast<char>(res);
+	}
+	
+	constexpr bool can_fail() const { return state_ != 1; }
+	
+	// the transitions of a state, for the table backend
+	static constexpr void for_each_run(int state, auto f)
+	{
+		for (int k = impl::xid::first[state]; k != impl::xid::first[state + 1]; ++k)
+			f(impl::xid::runs[k].lo, impl::xid::runs[k].hi, impl::xid::runs[k].next);
+	}
+	
+	constexpr bool operator==(const utf8_identifier_matcher&) const = default;
+	
+	int state_ = 0;
+	
+	private : 
+	
+	// every byte of the runs, as chars : their order depends on the signedness of char
+	constexpr void for_each_byte(auto f) const
+	{
+		if (state_ < 0)
+			return;
+		
+		for (int k = impl::xid::first[state_]; k != impl::xid::first[state_ + 1]; ++k)
+		{
+			const auto& r = impl::xid::runs[k];
+			
+			for (int b = r.lo; b <= r.hi; ++b)
+				f( static_cast<char>(b) );
+		}
+	}
+};
+
+static_assert( matcher<utf8_identifier_matcher> );
+
+inline constexpr utf8_identifier_matcher utf8_identifier;
+
+} // STRM
+
+#endif
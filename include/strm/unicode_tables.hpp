@@ -0,0 +1,294 @@
+// Generated by tools/unicode_tables.py (Unicode 14.0.0), do not edit
+
+#ifndef STRM_CPP_LIBRARY_UNICODE_TABLES_HEADER
+#define STRM_CPP_LIBRARY_UNICODE_TABLES_HEADER
+
+namespace strm::impl::xid {
+
+	// The UTF-8 automaton of (XID_Start | '_') XID_Continue*. State 0 is the starting state,
+	// state 1 the only accepting one, the others read the continuation bytes of a character.
+	// The transitions of state s are the runs [first[s], first[s + 1]).
+
+	struct run { unsigned char lo, hi; unsigned short next; };
+
+	inline constexpr int states = 439;
+
+	inline constexpr unsigned short first[440] = {
+		0, 36, 75, 78, 81, 82, 87, 91, 96, 98, 100, 102, 105, 106, 108, 109,
+		112, 118, 120, 121, 123, 126, 157, 161, 164, 167, 168, 170, 173, 181, 186, 193,
+		196, 203, 206, 213, 216, 226, 227, 232, 235, 242, 245, 249, 253, 257, 258, 260,
+		268, 271, 272, 274, 275, 321, 323, 329, 332, 337, 343, 348, 352, 355, 356, 358,
+		360, 361, 363, 365, 367, 369, 372, 373, 375, 376, 379, 380, 381, 383, 385, 387,
+		388, 389, 390, 391, 394, 395, 396, 398, 401, 405, 408, 415, 418, 425, 436, 438,
+		439, 449, 452, 455, 459, 461, 466, 470, 479, 483, 486, 488, 490, 492, 493, 495,
+		496, 525, 526, 527, 530, 532, 534, 535, 537, 539, 544, 548, 549, 552, 554, 556,
+		557, 561, 562, 567, 571, 576, 582, 585, 586, 589, 591, 593, 615, 617, 618, 625,
+		628, 629, 630, 632, 633, 634, 636, 638, 645, 646, 647, 649, 651, 655, 676, 719,
+		724, 726, 727, 728, 730, 731, 733, 735, 738, 740, 742, 744, 747, 754, 755, 757,
+		760, 766, 768, 770, 772, 774, 778, 779, 780, 782, 784, 785, 786, 788, 791, 793,
+		795, 797, 840, 841, 843, 844, 845, 846, 850, 851, 854, 856, 862, 864, 866, 868,
+		869, 870, 871, 873, 874, 876, 882, 883, 885, 888, 891, 893, 896, 898, 900, 901,
+		904, 908, 910, 911, 912, 920, 921, 922, 924, 926, 939, 941, 942, 943, 946, 948,
+		949, 951, 956, 957, 958, 959, 962, 970, 973, 974, 976, 978, 992, 994, 1002, 1004,
+		1010, 1014, 1016, 1020, 1023, 1026, 1029, 1031, 1043, 1045, 1046, 1050, 1051, 1053, 1062, 1081,
+		1086, 1089, 1090, 1095, 1098, 1100, 1102, 1103, 1105, 1106, 1108, 1109, 1113, 1117, 1121, 1124,
+		1127, 1132, 1134, 1136, 1141, 1143, 1146, 1178, 1179, 1182, 1185, 1187, 1190, 1198, 1207, 1217,
+		1224, 1232, 1239, 1247, 1255, 1266, 1272, 1277, 1285, 1292, 1300, 1303, 1310, 1315, 1322, 1323,
+		1325, 1331, 1336, 1343, 1346, 1349, 1350, 1396, 1398, 1401, 1403, 1407, 1411, 1414, 1416, 1419,
+		1421, 1423, 1425, 1428, 1433, 1434, 1437, 1439, 1441, 1454, 1455, 1459, 1462, 1464, 1467, 1472,
+		1481, 1485, 1489, 1518, 1520, 1523, 1525, 1530, 1532, 1535, 1539, 1543, 1546, 1569, 1575, 1578,
+		1586, 1589, 1612, 1656, 1657, 1659, 1661, 1664, 1671, 1673, 1675, 1678, 1680, 1724, 1727, 1730,
+		1732, 1735, 1739, 1742, 1744, 1752, 1760, 1763, 1766, 1768, 1770, 1773, 1776, 1778, 1785, 1787,
+		1790, 1792, 1795, 1798, 1801, 1804, 1810, 1815, 1819, 1820, 1833, 1836, 1839, 1843, 1845, 1847,
+		1850, 1858, 1861, 1863, 1883, 1886, 1889, 1890, 1893, 1895, 1897, 1900, 1913, 1918, 1920, 1922,
+		1923, 1924, 1926, 1928, 1929, 1930, 1931, 1933,
+	};
+
+	inline constexpr run runs[1933] = {
+		{0x41,0x5A,1}, {0x5F,0x5F,1}, {0x61,0x7A,1}, {0xC2,0xC2,2}, {0xC3,0xC3,3}, {0xC4,0xCA,4}, {0xCB,0xCB,5}, {0xCD,0xCD,6},
+		{0xCE,0xCE,7}, {0xCF,0xCF,8}, {0xD0,0xD1,4}, {0xD2,0xD2,9}, {0xD3,0xD3,4}, {0xD4,0xD4,10}, {0xD5,0xD5,11}, {0xD6,0xD6,12},
+		{0xD7,0xD7,13}, {0xD8,0xD8,14}, {0xD9,0xD9,15}, {0xDA,0xDA,4}, {0xDB,0xDB,16}, {0xDC,0xDC,17}, {0xDD,0xDD,18}, {0xDE,0xDE,19},
+		{0xDF,0xDF,20}, {0xE0,0xE0,21}, {0xE1,0xE1,52}, {0xE2,0xE2,93}, {0xE3,0xE3,103}, {0xE4,0xE4,110}, {0xE5,0xE9,111}, {0xEA,0xEA,112},
+		{0xEB,0xEC,111}, {0xED,0xED,136}, {0xEF,0xEF,139}, {0xF0,0xF0,157}, {0x30,0x39,1}, {0x41,0x5A,1}, {0x5F,0x5F,1}, {0x61,0x7A,1},
+		{0xC2,0xC2,283}, {0xC3,0xC3,3}, {0xC4,0xCA,4}, {0xCB,0xCB,5}, {0xCC,0xCC,4}, {0xCD,0xCD,284}, {0xCE,0xCE,285}, {0xCF,0xCF,8},
+		{0xD0,0xD1,4}, {0xD2,0xD2,286}, {0xD3,0xD3,4}, {0xD4,0xD4,10}, {0xD5,0xD5,11}, {0xD6,0xD6,287}, {0xD7,0xD7,288}, {0xD8,0xD8,289},
+		{0xD9,0xD9,290}, {0xDA,0xDA,4}, {0xDB,0xDB,291}, {0xDC,0xDC,148}, {0xDD,0xDD,292}, {0xDE,0xDE,144}, {0xDF,0xDF,293}, {0xE0,0xE0,294},
+		{0xE1,0xE1,326}, {0xE2,0xE2,344}, {0xE3,0xE3,351}, {0xE4,0xE4,110}, {0xE5,0xE9,111}, {0xEA,0xEA,354}, {0xEB,0xEC,111}, {0xED,0xED,136},
+		{0xEF,0xEF,364}, {0xF0,0xF0,369}, {0xF3,0xF3,437}, {0xAA,0xAA,1}, {0xB5,0xB5,1}, {0xBA,0xBA,1}, {0x80,0x96,1}, {0x98,0xB6,1},
+		{0xB8,0xBF,1}, {0x80,0xBF,1}, {0x80,0x81,1}, {0x86,0x91,1}, {0xA0,0xA4,1}, {0xAC,0xAC,1}, {0xAE,0xAE,1}, {0xB0,0xB4,1},
+		{0xB6,0xB7,1}, {0xBB,0xBD,1}, {0xBF,0xBF,1}, {0x86,0x86,1}, {0x88,0x8A,1}, {0x8C,0x8C,1}, {0x8E,0xA1,1}, {0xA3,0xBF,1},
+		{0x80,0xB5,1}, {0xB7,0xBF,1}, {0x80,0x81,1}, {0x8A,0xBF,1}, {0x80,0xAF,1}, {0xB1,0xBF,1}, {0x80,0x96,1}, {0x99,0x99,1},
+		{0xA0,0xBF,1}, {0x80,0x88,1}, {0x90,0xAA,1}, {0xAF,0xB2,1}, {0xA0,0xBF,1}, {0x80,0x8A,1}, {0xAE,0xAF,1}, {0xB1,0xBF,1},
+		{0x80,0x93,1}, {0x95,0x95,1}, {0xA5,0xA6,1}, {0xAE,0xAF,1}, {0xBA,0xBC,1}, {0xBF,0xBF,1}, {0x90,0x90,1}, {0x92,0xAF,1},
+		{0x8D,0xBF,1}, {0x80,0xA5,1}, {0xB1,0xB1,1}, {0x8A,0xAA,1}, {0xB4,0xB5,1}, {0xBA,0xBA,1}, {0xA0,0xA0,22}, {0xA1,0xA1,23},
+		{0xA2,0xA2,24}, {0xA3,0xA3,25}, {0xA4,0xA4,26}, {0xA5,0xA5,27}, {0xA6,0xA6,28}, {0xA7,0xA7,29}, {0xA8,0xA8,30}, {0xA9,0xA9,31},
+		{0xAA,0xAA,32}, {0xAB,0xAB,33}, {0xAC,0xAC,34}, {0xAD,0xAD,35}, {0xAE,0xAE,36}, {0xAF,0xAF,37}, {0xB0,0xB0,38}, {0xB1,0xB1,39},
+		{0xB2,0xB2,40}, {0xB3,0xB3,41}, {0xB4,0xB4,42}, {0xB5,0xB5,43}, {0xB6,0xB6,44}, {0xB7,0xB7,45}, {0xB8,0xB8,46}, {0xB9,0xB9,45},
+		{0xBA,0xBA,47}, {0xBB,0xBB,48}, {0xBC,0xBC,49}, {0xBD,0xBD,50}, {0xBE,0xBE,51}, {0x80,0x95,1}, {0x9A,0x9A,1}, {0xA4,0xA4,1},
+		{0xA8,0xA8,1}, {0x80,0x98,1}, {0xA0,0xAA,1}, {0xB0,0xBF,1}, {0x80,0x87,1}, {0x89,0x8E,1}, {0xA0,0xBF,1}, {0x80,0x89,1},
+		{0x84,0xB9,1}, {0xBD,0xBD,1}, {0x90,0x90,1}, {0x98,0xA1,1}, {0xB1,0xBF,1}, {0x80,0x80,1}, {0x85,0x8C,1}, {0x8F,0x90,1},
+		{0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB2,1}, {0xB6,0xB9,1}, {0xBD,0xBD,1}, {0x8E,0x8E,1}, {0x9C,0x9D,1}, {0x9F,0xA1,1},
+		{0xB0,0xB1,1}, {0xBC,0xBC,1}, {0x85,0x8A,1}, {0x8F,0x90,1}, {0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB3,1}, {0xB5,0xB6,1},
+		{0xB8,0xB9,1}, {0x99,0x9C,1}, {0x9E,0x9E,1}, {0xB2,0xB4,1}, {0x85,0x8D,1}, {0x8F,0x91,1}, {0x93,0xA8,1}, {0xAA,0xB0,1},
+		{0xB2,0xB3,1}, {0xB5,0xB9,1}, {0xBD,0xBD,1}, {0x90,0x90,1}, {0xA0,0xA1,1}, {0xB9,0xB9,1}, {0x85,0x8C,1}, {0x8F,0x90,1},
+		{0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB3,1}, {0xB5,0xB9,1}, {0xBD,0xBD,1}, {0x9C,0x9D,1}, {0x9F,0xA1,1}, {0xB1,0xB1,1},
+		{0x83,0x83,1}, {0x85,0x8A,1}, {0x8E,0x90,1}, {0x92,0x95,1}, {0x99,0x9A,1}, {0x9C,0x9C,1}, {0x9E,0x9F,1}, {0xA3,0xA4,1},
+		{0xA8,0xAA,1}, {0xAE,0xB9,1}, {0x90,0x90,1}, {0x85,0x8C,1}, {0x8E,0x90,1}, {0x92,0xA8,1}, {0xAA,0xB9,1}, {0xBD,0xBD,1},
+		{0x98,0x9A,1}, {0x9D,0x9D,1}, {0xA0,0xA1,1}, {0x80,0x80,1}, {0x85,0x8C,1}, {0x8E,0x90,1}, {0x92,0xA8,1}, {0xAA,0xB3,1},
+		{0xB5,0xB9,1}, {0xBD,0xBD,1}, {0x9D,0x9E,1}, {0xA0,0xA1,1}, {0xB1,0xB2,1}, {0x84,0x8C,1}, {0x8E,0x90,1}, {0x92,0xBA,1},
+		{0xBD,0xBD,1}, {0x8E,0x8E,1}, {0x94,0x96,1}, {0x9F,0xA1,1}, {0xBA,0xBF,1}, {0x85,0x96,1}, {0x9A,0xB1,1}, {0xB3,0xBB,1},
+		{0xBD,0xBD,1}, {0x80,0x86,1}, {0x81,0xB0,1}, {0xB2,0xB2,1}, {0x81,0x82,1}, {0x84,0x84,1}, {0x86,0x8A,1}, {0x8C,0xA3,1},
+		{0xA5,0xA5,1}, {0xA7,0xB0,1}, {0xB2,0xB2,1}, {0xBD,0xBD,1}, {0x80,0x84,1}, {0x86,0x86,1}, {0x9C,0x9F,1}, {0x80,0x80,1},
+		{0x80,0x87,1}, {0x89,0xAC,1}, {0x88,0x8C,1}, {0x80,0x80,53}, {0x81,0x81,54}, {0x82,0x82,55}, {0x83,0x83,56}, {0x84,0x88,4},
+		{0x89,0x89,57}, {0x8A,0x8A,58}, {0x8B,0x8B,59}, {0x8C,0x8C,60}, {0x8D,0x8D,61}, {0x8E,0x8E,62}, {0x8F,0x8F,63}, {0x90,0x90,64},
+		{0x91,0x98,4}, {0x99,0x99,65}, {0x9A,0x9A,66}, {0x9B,0x9B,67}, {0x9C,0x9C,68}, {0x9D,0x9D,69}, {0x9E,0x9E,70}, {0x9F,0x9F,71},
+		{0xA0,0xA0,14}, {0xA1,0xA1,72}, {0xA2,0xA2,73}, {0xA3,0xA3,74}, {0xA4,0xA4,75}, {0xA5,0xA5,76}, {0xA6,0xA6,77}, {0xA7,0xA7,25},
+		{0xA8,0xA8,78}, {0xA9,0xA9,79}, {0xAA,0xAA,80}, {0xAC,0xAC,81}, {0xAD,0xAD,82}, {0xAE,0xAE,83}, {0xAF,0xAF,84}, {0xB0,0xB0,85},
+		{0xB1,0xB1,86}, {0xB2,0xB2,87}, {0xB3,0xB3,88}, {0xB4,0xB6,4}, {0xB8,0xBB,4}, {0xBC,0xBC,89}, {0xBD,0xBD,90}, {0xBE,0xBE,91},
+		{0xBF,0xBF,92}, {0x80,0xAA,1}, {0xBF,0xBF,1}, {0x90,0x95,1}, {0x9A,0x9D,1}, {0xA1,0xA1,1}, {0xA5,0xA6,1}, {0xAE,0xB0,1},
+		{0xB5,0xBF,1}, {0x80,0x81,1}, {0x8E,0x8E,1}, {0xA0,0xBF,1}, {0x80,0x85,1}, {0x87,0x87,1}, {0x8D,0x8D,1}, {0x90,0xBA,1},
+		{0xBC,0xBF,1}, {0x80,0x88,1}, {0x8A,0x8D,1}, {0x90,0x96,1}, {0x98,0x98,1}, {0x9A,0x9D,1}, {0xA0,0xBF,1}, {0x80,0x88,1},
+		{0x8A,0x8D,1}, {0x90,0xB0,1}, {0xB2,0xB5,1}, {0xB8,0xBE,1}, {0x80,0x80,1}, {0x82,0x85,1}, {0x88,0x96,1}, {0x98,0xBF,1},
+		{0x80,0x90,1}, {0x92,0x95,1}, {0x98,0xBF,1}, {0x80,0x9A,1}, {0x80,0x8F,1}, {0xA0,0xBF,1}, {0x80,0xB5,1}, {0xB8,0xBD,1},
+		{0x81,0xBF,1}, {0x80,0xAC,1}, {0xAF,0xBF,1}, {0x81,0x9A,1}, {0xA0,0xBF,1}, {0x80,0xAA,1}, {0xAE,0xB8,1}, {0x80,0x91,1},
+		{0x9F,0xB1,1}, {0x80,0x91,1}, {0xA0,0xAC,1}, {0xAE,0xB0,1}, {0x80,0xB3,1}, {0x97,0x97,1}, {0x9C,0x9C,1}, {0x80,0xB8,1},
+		{0x80,0xA8,1}, {0xAA,0xAA,1}, {0xB0,0xBF,1}, {0x80,0xB5,1}, {0x80,0x9E,1}, {0x90,0xAD,1}, {0xB0,0xB4,1}, {0x80,0xAB,1},
+		{0xB0,0xBF,1}, {0x80,0x96,1}, {0xA0,0xBF,1}, {0x80,0x94,1}, {0xA7,0xA7,1}, {0x85,0xB3,1}, {0x85,0x8C,1}, {0x83,0xA0,1},
+		{0xAE,0xAF,1}, {0xBA,0xBF,1}, {0x80,0xA5,1}, {0x80,0xA3,1}, {0x8D,0x8F,1}, {0x9A,0xBD,1}, {0x80,0x88,1}, {0x90,0xBA,1},
+		{0xBD,0xBF,1}, {0xA9,0xAC,1}, {0xAE,0xB3,1}, {0xB5,0xB6,1}, {0xBA,0xBA,1}, {0x80,0x95,1}, {0x98,0x9D,1}, {0xA0,0xBF,1},
+		{0x80,0x85,1}, {0x88,0x8D,1}, {0x90,0x97,1}, {0x99,0x99,1}, {0x9B,0x9B,1}, {0x9D,0x9D,1}, {0x9F,0xBD,1}, {0x80,0xB4,1},
+		{0xB6,0xBC,1}, {0xBE,0xBE,1}, {0x82,0x84,1}, {0x86,0x8C,1}, {0x90,0x93,1}, {0x96,0x9B,1}, {0xA0,0xAC,1}, {0xB2,0xB4,1},
+		{0xB6,0xBC,1}, {0x81,0x81,94}, {0x82,0x82,95}, {0x84,0x84,96}, {0x85,0x85,97}, {0x86,0x86,12}, {0xB0,0xB2,4}, {0xB3,0xB3,98},
+		{0xB4,0xB4,99}, {0xB5,0xB5,100}, {0xB6,0xB6,101}, {0xB7,0xB7,102}, {0xB1,0xB1,1}, {0xBF,0xBF,1}, {0x90,0x9C,1}, {0x82,0x82,1},
+		{0x87,0x87,1}, {0x8A,0x93,1}, {0x95,0x95,1}, {0x98,0x9D,1}, {0xA4,0xA4,1}, {0xA6,0xA6,1}, {0xA8,0xA8,1}, {0xAA,0xB9,1},
+		{0xBC,0xBF,1}, {0x85,0x89,1}, {0x8E,0x8E,1}, {0xA0,0xBF,1}, {0x80,0xA4,1}, {0xAB,0xAE,1}, {0xB2,0xB3,1}, {0x80,0xA5,1},
+		{0xA7,0xA7,1}, {0xAD,0xAD,1}, {0xB0,0xBF,1}, {0x80,0xA7,1}, {0xAF,0xAF,1}, {0x80,0x96,1}, {0xA0,0xA6,1}, {0xA8,0xAE,1},
+		{0xB0,0xB6,1}, {0xB8,0xBE,1}, {0x80,0x86,1}, {0x88,0x8E,1}, {0x90,0x96,1}, {0x98,0x9E,1}, {0x80,0x80,104}, {0x81,0x81,64},
+		{0x82,0x82,105}, {0x83,0x83,106}, {0x84,0x84,107}, {0x85,0x85,4}, {0x86,0x86,108}, {0x87,0x87,109}, {0x90,0xBF,4}, {0x85,0x87,1},
+		{0xA1,0xA9,1}, {0xB1,0xB5,1}, {0xB8,0xBC,1}, {0x80,0x96,1}, {0x9D,0x9F,1}, {0xA1,0xBF,1}, {0x80,0xBA,1}, {0xBC,0xBF,1},
+		{0x85,0xAF,1}, {0xB1,0xBF,1}, {0x80,0x8E,1}, {0xA0,0xBF,1}, {0xB0,0xBF,1}, {0x80,0xB6,4}, {0xB8,0xBF,4}, {0x80,0xBF,4},
+		{0x80,0x91,4}, {0x92,0x92,113}, {0x93,0x93,114}, {0x94,0x97,4}, {0x98,0x98,115}, {0x99,0x99,116}, {0x9A,0x9A,117}, {0x9B,0x9B,118},
+		{0x9C,0x9C,119}, {0x9D,0x9D,4}, {0x9E,0x9E,120}, {0x9F,0x9F,121}, {0xA0,0xA0,122}, {0xA1,0xA1,70}, {0xA2,0xA2,123}, {0xA3,0xA3,124},
+		{0xA4,0xA4,125}, {0xA5,0xA5,126}, {0xA6,0xA6,127}, {0xA7,0xA7,128}, {0xA8,0xA8,129}, {0xA9,0xA9,130}, {0xAA,0xAA,131}, {0xAB,0xAB,132},
+		{0xAC,0xAC,133}, {0xAD,0xAD,134}, {0xAE,0xAE,4}, {0xAF,0xAF,135}, {0xB0,0xBF,4}, {0x80,0x8C,1}, {0x90,0xBD,1}, {0x80,0x8C,1},
+		{0x90,0x9F,1}, {0xAA,0xAB,1}, {0x80,0xAE,1}, {0xBF,0xBF,1}, {0x80,0x9D,1}, {0xA0,0xBF,1}, {0x80,0xAF,1}, {0x97,0x9F,1},
+		{0xA2,0xBF,1}, {0x80,0x88,1}, {0x8B,0xBF,1}, {0x80,0x8A,1}, {0x90,0x91,1}, {0x93,0x93,1}, {0x95,0x99,1}, {0xB2,0xBF,1},
+		{0x80,0x81,1}, {0x83,0x85,1}, {0x87,0x8A,1}, {0x8C,0xA2,1}, {0x82,0xB3,1}, {0xB2,0xB7,1}, {0xBB,0xBB,1}, {0xBD,0xBE,1},
+		{0x8A,0xA5,1}, {0xB0,0xBF,1}, {0x80,0x86,1}, {0xA0,0xBC,1}, {0x84,0xB2,1}, {0x8F,0x8F,1}, {0xA0,0xA4,1}, {0xA6,0xAF,1},
+		{0xBA,0xBE,1}, {0x80,0xA8,1}, {0x80,0x82,1}, {0x84,0x8B,1}, {0xA0,0xB6,1}, {0xBA,0xBA,1}, {0xBE,0xBF,1}, {0x80,0xAF,1},
+		{0xB1,0xB1,1}, {0xB5,0xB6,1}, {0xB9,0xBD,1}, {0x80,0x80,1}, {0x82,0x82,1}, {0x9B,0x9D,1}, {0xA0,0xAA,1}, {0xB2,0xB4,1},
+		{0x81,0x86,1}, {0x89,0x8E,1}, {0x91,0x96,1}, {0xA0,0xA6,1}, {0xA8,0xAE,1}, {0xB0,0xBF,1}, {0x80,0x9A,1}, {0x9C,0xA9,1},
+		{0xB0,0xBF,1}, {0x80,0xA2,1}, {0x80,0x9D,4}, {0x9E,0x9E,137}, {0x9F,0x9F,138}, {0x80,0xA3,1}, {0xB0,0xBF,1}, {0x80,0x86,1},
+		{0x8B,0xBB,1}, {0xA4,0xA8,4}, {0xA9,0xA9,140}, {0xAA,0xAA,4}, {0xAB,0xAB,141}, {0xAC,0xAC,142}, {0xAD,0xAD,143}, {0xAE,0xAE,144},
+		{0xAF,0xAF,145}, {0xB0,0xB0,4}, {0xB1,0xB1,146}, {0xB2,0xB3,4}, {0xB4,0xB4,147}, {0xB5,0xB5,148}, {0xB6,0xB6,149}, {0xB7,0xB7,150},
+		{0xB9,0xB9,151}, {0xBA,0xBA,4}, {0xBB,0xBB,152}, {0xBC,0xBC,153}, {0xBD,0xBD,154}, {0xBE,0xBE,155}, {0xBF,0xBF,156}, {0x80,0xAD,1},
+		{0xB0,0xBF,1}, {0x80,0x99,1}, {0x80,0x86,1}, {0x93,0x97,1}, {0x9D,0x9D,1}, {0x9F,0xA8,1}, {0xAA,0xB6,1}, {0xB8,0xBC,1},
+		{0xBE,0xBE,1}, {0x80,0x81,1}, {0x83,0x84,1}, {0x86,0xBF,1}, {0x80,0xB1,1}, {0x93,0xBF,1}, {0x80,0x9D,1}, {0xA4,0xBF,1},
+		{0x80,0xBD,1}, {0x90,0xBF,1}, {0x80,0x8F,1}, {0x92,0xBF,1}, {0x80,0x87,1}, {0xB0,0xB9,1}, {0xB1,0xB1,1}, {0xB3,0xB3,1},
+		{0xB7,0xB7,1}, {0xB9,0xB9,1}, {0xBB,0xBB,1}, {0xBD,0xBD,1}, {0xBF,0xBF,1}, {0x80,0xBC,1}, {0xA1,0xBA,1}, {0x81,0x9A,1},
+		{0xA6,0xBF,1}, {0x80,0x9D,1}, {0xA0,0xBE,1}, {0x82,0x87,1}, {0x8A,0x8F,1}, {0x92,0x97,1}, {0x9A,0x9C,1}, {0x90,0x90,158},
+		{0x91,0x91,193}, {0x92,0x92,228}, {0x93,0x93,231}, {0x94,0x94,232}, {0x96,0x96,233}, {0x97,0x97,111}, {0x98,0x98,241}, {0x9A,0x9A,244},
+		{0x9B,0x9B,246}, {0x9D,0x9D,251}, {0x9E,0x9E,263}, {0xA0,0xA9,111}, {0xAA,0xAA,272}, {0xAB,0xAB,274}, {0xAC,0xAC,275}, {0xAD,0xAD,111},
+		{0xAE,0xAE,277}, {0xAF,0xAF,279}, {0xB0,0xB0,111}, {0xB1,0xB1,281}, {0x80,0x80,159}, {0x81,0x81,160}, {0x82,0x82,4}, {0x83,0x83,161},
+		{0x85,0x85,162}, {0x8A,0x8A,163}, {0x8B,0x8B,164}, {0x8C,0x8C,165}, {0x8D,0x8D,166}, {0x8E,0x8E,117}, {0x8F,0x8F,167}, {0x90,0x91,4},
+		{0x92,0x92,168}, {0x93,0x93,169}, {0x94,0x94,170}, {0x95,0x95,171}, {0x96,0x96,172}, {0x98,0x9B,4}, {0x9C,0x9C,173}, {0x9D,0x9D,174},
+		{0x9E,0x9E,175}, {0xA0,0xA0,176}, {0xA1,0xA1,177}, {0xA2,0xA2,75}, {0xA3,0xA3,178}, {0xA4,0xA4,179}, {0xA6,0xA6,180}, {0xA8,0xA8,181},
+		{0xA9,0xA9,182}, {0xAA,0xAA,183}, {0xAB,0xAB,184}, {0xAC,0xAC,74}, {0xAD,0xAD,185}, {0xAE,0xAE,186}, {0xB0,0xB0,4}, {0xB1,0xB1,12},
+		{0xB2,0xB3,187}, {0xB4,0xB4,85}, {0xBA,0xBA,188}, {0xBC,0xBC,189}, {0xBD,0xBD,190}, {0xBE,0xBE,191}, {0xBF,0xBF,192}, {0x80,0x8B,1},
+		{0x8D,0xA6,1}, {0xA8,0xBA,1}, {0xBC,0xBD,1}, {0xBF,0xBF,1}, {0x80,0x8D,1}, {0x90,0x9D,1}, {0x80,0xBA,1}, {0x80,0xB4,1},
+		{0x80,0x9C,1}, {0xA0,0xBF,1}, {0x80,0x90,1}, {0x80,0x9F,1}, {0xAD,0xBF,1}, {0x80,0x8A,1}, {0x90,0xB5,1}, {0x80,0x83,1},
+		{0x88,0x8F,1}, {0x91,0x95,1}, {0x80,0x9D,1}, {0xB0,0xBF,1}, {0x80,0x93,1}, {0x98,0xBB,1}, {0x80,0xA7,1}, {0xB0,0xBF,1},
+		{0x80,0xA3,1}, {0xB0,0xBA,1}, {0xBC,0xBF,1}, {0x80,0x8A,1}, {0x8C,0x92,1}, {0x94,0x95,1}, {0x97,0xA1,1}, {0xA3,0xB1,1},
+		{0xB3,0xB9,1}, {0xBB,0xBC,1}, {0x80,0xB6,1}, {0x80,0x95,1}, {0xA0,0xA7,1}, {0x80,0x85,1}, {0x87,0xB0,1}, {0xB2,0xBA,1},
+		{0x80,0x85,1}, {0x88,0x88,1}, {0x8A,0xB5,1}, {0xB7,0xB8,1}, {0xBC,0xBC,1}, {0xBF,0xBF,1}, {0x80,0x95,1}, {0xA0,0xB6,1},
+		{0xA0,0xB2,1}, {0xB4,0xB5,1}, {0x80,0x95,1}, {0xA0,0xB9,1}, {0x80,0xB7,1}, {0xBE,0xBF,1}, {0x80,0x80,1}, {0x90,0x93,1},
+		{0x95,0x97,1}, {0x99,0xB5,1}, {0xA0,0xBC,1}, {0x80,0x9C,1}, {0x80,0x87,1}, {0x89,0xA4,1}, {0x80,0x95,1}, {0xA0,0xB2,1},
+		{0x80,0x91,1}, {0x80,0xB2,1}, {0x80,0xA9,1}, {0xB0,0xB1,1}, {0x80,0x9C,1}, {0xA7,0xA7,1}, {0xB0,0xBF,1}, {0x80,0x85,1},
+		{0xB0,0xBF,1}, {0x80,0x81,1}, {0xB0,0xBF,1}, {0x80,0x84,1}, {0xA0,0xB6,1}, {0x80,0x80,194}, {0x81,0x81,195}, {0x82,0x82,196},
+		{0x83,0x83,197}, {0x84,0x84,198}, {0x85,0x85,199}, {0x86,0x86,200}, {0x87,0x87,201}, {0x88,0x88,202}, {0x8A,0x8A,203}, {0x8B,0x8B,75},
+		{0x8C,0x8C,34}, {0x8D,0x8D,204}, {0x90,0x90,162}, {0x91,0x91,205}, {0x92,0x92,118}, {0x93,0x93,206}, {0x96,0x96,207}, {0x97,0x97,208},
+		{0x98,0x98,118}, {0x99,0x99,209}, {0x9A,0x9A,210}, {0x9C,0x9C,61}, {0x9D,0x9D,45}, {0xA0,0xA0,211}, {0xA2,0xA2,14}, {0xA3,0xA3,212},
+		{0xA4,0xA4,213}, {0xA5,0xA5,214}, {0xA6,0xA6,215}, {0xA7,0xA7,216}, {0xA8,0xA8,217}, {0xA9,0xA9,218}, {0xAA,0xAA,219}, {0xAB,0xAB,72},
+		{0xB0,0xB0,220}, {0xB1,0xB1,221}, {0xB2,0xB2,222}, {0xB4,0xB4,223}, {0xB5,0xB5,224}, {0xB6,0xB6,225}, {0xBB,0xBB,226}, {0xBE,0xBE,227},
+		{0x83,0xB7,1}, {0xB1,0xB2,1}, {0xB5,0xB5,1}, {0x83,0xAF,1}, {0x90,0xA8,1}, {0x83,0xA6,1}, {0x84,0x84,1}, {0x87,0x87,1},
+		{0x90,0xB2,1}, {0xB6,0xB6,1}, {0x83,0xB2,1}, {0x81,0x84,1}, {0x9A,0x9A,1}, {0x9C,0x9C,1}, {0x80,0x91,1}, {0x93,0xAB,1},
+		{0x80,0x86,1}, {0x88,0x88,1}, {0x8A,0x8D,1}, {0x8F,0x9D,1}, {0x9F,0xA8,1}, {0xB0,0xBF,1}, {0x90,0x90,1}, {0x9D,0xA1,1},
+		{0x87,0x8A,1}, {0x9F,0xA1,1}, {0x84,0x85,1}, {0x87,0x87,1}, {0x80,0xAE,1}, {0x98,0x9B,1}, {0x84,0x84,1}, {0x80,0xAA,1},
+		{0xB8,0xB8,1}, {0x80,0xAB,1}, {0x80,0x9F,1}, {0xBF,0xBF,1}, {0x80,0x86,1}, {0x89,0x89,1}, {0x8C,0x93,1}, {0x95,0x96,1},
+		{0x98,0xAF,1}, {0xBF,0xBF,1}, {0x81,0x81,1}, {0xA0,0xA7,1}, {0xAA,0xBF,1}, {0x80,0x90,1}, {0xA1,0xA1,1}, {0xA3,0xA3,1},
+		{0x80,0x80,1}, {0x8B,0xB2,1}, {0xBA,0xBA,1}, {0x90,0x90,1}, {0x9C,0xBF,1}, {0x80,0x89,1}, {0x9D,0x9D,1}, {0xB0,0xBF,1},
+		{0x80,0x88,1}, {0x8A,0xAE,1}, {0x80,0x80,1}, {0xB2,0xBF,1}, {0x80,0x8F,1}, {0x80,0x86,1}, {0x88,0x89,1}, {0x8B,0xB0,1},
+		{0x86,0x86,1}, {0xA0,0xA5,1}, {0xA7,0xA8,1}, {0xAA,0xBF,1}, {0x80,0x89,1}, {0x98,0x98,1}, {0xA0,0xB2,1}, {0xB0,0xB0,1},
+		{0x80,0x8D,4}, {0x8E,0x8E,141}, {0x90,0x90,4}, {0x91,0x91,207}, {0x92,0x94,4}, {0x95,0x95,229}, {0xBE,0xBE,148}, {0xBF,0xBF,230},
+		{0x80,0x83,1}, {0x80,0xB0,1}, {0x80,0x8F,4}, {0x90,0x90,207}, {0x90,0x98,4}, {0x99,0x99,45}, {0xA0,0xA7,4}, {0xA8,0xA8,72},
+		{0xA9,0xA9,234}, {0xAA,0xAA,235}, {0xAB,0xAB,236}, {0xAC,0xAC,118}, {0xAD,0xAD,237}, {0xAE,0xAE,222}, {0xB9,0xB9,4}, {0xBC,0xBC,4},
+		{0xBD,0xBD,238}, {0xBE,0xBE,239}, {0xBF,0xBF,240}, {0x80,0x9E,1}, {0xB0,0xBF,1}, {0x80,0xBE,1}, {0x90,0xAD,1}, {0x80,0x83,1},
+		{0xA3,0xB7,1}, {0xBD,0xBF,1}, {0x80,0x8A,1}, {0x90,0x90,1}, {0x93,0x9F,1}, {0xA0,0xA1,1}, {0xA3,0xA3,1}, {0x80,0x9E,4},
+		{0x9F,0x9F,242}, {0xA0,0xB2,4}, {0xB3,0xB3,243}, {0xB4,0xB4,12}, {0x80,0xB7,1}, {0x80,0x95,1}, {0xBF,0xBF,245}, {0xB0,0xB3,1},
+		{0xB5,0xBB,1}, {0xBD,0xBE,1}, {0x80,0x83,4}, {0x84,0x84,135}, {0x85,0x85,247}, {0x86,0x8A,4}, {0x8B,0x8B,248}, {0xB0,0xB0,4},
+		{0xB1,0xB1,249}, {0xB2,0xB2,250}, {0x90,0x92,1}, {0xA4,0xA7,1}, {0xB0,0xBF,1}, {0x80,0xBB,1}, {0x80,0xAA,1}, {0xB0,0xBC,1},
+		{0x80,0x88,1}, {0x90,0x99,1}, {0x90,0x90,4}, {0x91,0x91,252}, {0x92,0x92,253}, {0x93,0x93,254}, {0x94,0x94,255}, {0x95,0x95,256},
+		{0x96,0x99,4}, {0x9A,0x9A,257}, {0x9B,0x9B,258}, {0x9C,0x9C,259}, {0x9D,0x9D,260}, {0x9E,0x9E,261}, {0x9F,0x9F,262}, {0xBC,0xBC,75},
+		{0x80,0x94,1}, {0x96,0xBF,1}, {0x80,0x9C,1}, {0x9E,0x9F,1}, {0xA2,0xA2,1}, {0xA5,0xA6,1}, {0xA9,0xAC,1}, {0xAE,0xB9,1},
+		{0xBB,0xBB,1}, {0xBD,0xBF,1}, {0x80,0x83,1}, {0x85,0xBF,1}, {0x80,0x85,1}, {0x87,0x8A,1}, {0x8D,0x94,1}, {0x96,0x9C,1},
+		{0x9E,0xB9,1}, {0xBB,0xBE,1}, {0x80,0x84,1}, {0x86,0x86,1}, {0x8A,0x90,1}, {0x92,0xBF,1}, {0x80,0xA5,1}, {0xA8,0xBF,1},
+		{0x80,0x80,1}, {0x82,0x9A,1}, {0x9C,0xBA,1}, {0xBC,0xBF,1}, {0x80,0x94,1}, {0x96,0xB4,1}, {0xB6,0xBF,1}, {0x80,0x8E,1},
+		{0x90,0xAE,1}, {0xB0,0xBF,1}, {0x80,0x88,1}, {0x8A,0xA8,1}, {0xAA,0xBF,1}, {0x80,0x82,1}, {0x84,0x8B,1}, {0x84,0x84,264},
+		{0x85,0x85,265}, {0x8A,0x8A,236}, {0x8B,0x8B,211}, {0x9F,0x9F,266}, {0xA0,0xA2,4}, {0xA3,0xA3,267}, {0xA4,0xA4,4}, {0xA5,0xA5,268},
+		{0xB8,0xB8,269}, {0xB9,0xB9,270}, {0xBA,0xBA,271}, {0x80,0xAC,1}, {0xB7,0xBD,1}, {0x8E,0x8E,1}, {0xA0,0xA6,1}, {0xA8,0xAB,1},
+		{0xAD,0xAE,1}, {0xB0,0xBE,1}, {0x80,0x84,1}, {0x80,0x83,1}, {0x8B,0x8B,1}, {0x80,0x83,1}, {0x85,0x9F,1}, {0xA1,0xA2,1},
+		{0xA4,0xA4,1}, {0xA7,0xA7,1}, {0xA9,0xB2,1}, {0xB4,0xB7,1}, {0xB9,0xB9,1}, {0xBB,0xBB,1}, {0x82,0x82,1}, {0x87,0x87,1},
+		{0x89,0x89,1}, {0x8B,0x8B,1}, {0x8D,0x8F,1}, {0x91,0x92,1}, {0x94,0x94,1}, {0x97,0x97,1}, {0x99,0x99,1}, {0x9B,0x9B,1},
+		{0x9D,0x9D,1}, {0x9F,0x9F,1}, {0xA1,0xA2,1}, {0xA4,0xA4,1}, {0xA7,0xAA,1}, {0xAC,0xB2,1}, {0xB4,0xB7,1}, {0xB9,0xBC,1},
+		{0xBE,0xBE,1}, {0x80,0x89,1}, {0x8B,0x9B,1}, {0xA1,0xA3,1}, {0xA5,0xA9,1}, {0xAB,0xBB,1}, {0x80,0x9A,4}, {0x9B,0x9B,273},
+		{0x9C,0xBF,4}, {0x80,0x9F,1}, {0x80,0x9B,4}, {0x9C,0x9C,72}, {0x9D,0x9F,4}, {0xA0,0xA0,117}, {0xA1,0xBF,4}, {0x80,0xB9,4},
+		{0xBA,0xBA,276}, {0xBB,0xBF,4}, {0x80,0xA1,1}, {0xB0,0xBF,1}, {0x80,0xAE,4}, {0xAF,0xAF,278}, {0x80,0xA0,1}, {0xA0,0xA7,4},
+		{0xA8,0xA8,280}, {0x80,0x9D,1}, {0x80,0x8C,4}, {0x8D,0x8D,282}, {0x80,0x8A,1}, {0xAA,0xAA,1}, {0xB5,0xB5,1}, {0xB7,0xB7,1},
+		{0xBA,0xBA,1}, {0x80,0xB4,1}, {0xB6,0xB7,1}, {0xBB,0xBD,1}, {0xBF,0xBF,1}, {0x86,0x8A,1}, {0x8C,0x8C,1}, {0x8E,0xA1,1},
+		{0xA3,0xBF,1}, {0x80,0x81,1}, {0x83,0x87,1}, {0x8A,0xBF,1}, {0x80,0x88,1}, {0x91,0xBD,1}, {0xBF,0xBF,1}, {0x81,0x82,1},
+		{0x84,0x85,1}, {0x87,0x87,1}, {0x90,0xAA,1}, {0xAF,0xB2,1}, {0x90,0x9A,1}, {0xA0,0xBF,1}, {0x80,0xA9,1}, {0xAE,0xBF,1},
+		{0x80,0x93,1}, {0x95,0x9C,1}, {0x9F,0xA8,1}, {0xAA,0xBC,1}, {0xBF,0xBF,1}, {0x80,0x8A,1}, {0x8D,0xBF,1}, {0x80,0xB5,1},
+		{0xBA,0xBA,1}, {0xBD,0xBD,1}, {0xA0,0xA0,295}, {0xA1,0xA1,296}, {0xA2,0xA2,297}, {0xA3,0xA3,298}, {0xA4,0xA4,4}, {0xA5,0xA5,299},
+		{0xA6,0xA6,300}, {0xA7,0xA7,301}, {0xA8,0xA8,302}, {0xA9,0xA9,303}, {0xAA,0xAA,304}, {0xAB,0xAB,305}, {0xAC,0xAC,306}, {0xAD,0xAD,307},
+		{0xAE,0xAE,308}, {0xAF,0xAF,309}, {0xB0,0xB0,310}, {0xB1,0xB1,311}, {0xB2,0xB2,312}, {0xB3,0xB3,313}, {0xB4,0xB4,314}, {0xB5,0xB5,315},
+		{0xB6,0xB6,316}, {0xB7,0xB7,317}, {0xB8,0xB8,318}, {0xB9,0xB9,319}, {0xBA,0xBA,320}, {0xBB,0xBB,321}, {0xBC,0xBC,322}, {0xBD,0xBD,323},
+		{0xBE,0xBE,324}, {0xBF,0xBF,325}, {0x80,0xAD,1}, {0x80,0x9B,1}, {0xA0,0xAA,1}, {0xB0,0xBF,1}, {0x80,0x87,1}, {0x89,0x8E,1},
+		{0x98,0xBF,1}, {0x80,0xA1,1}, {0xA3,0xBF,1}, {0x80,0xA3,1}, {0xA6,0xAF,1}, {0xB1,0xBF,1}, {0x80,0x83,1}, {0x85,0x8C,1},
+		{0x8F,0x90,1}, {0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB2,1}, {0xB6,0xB9,1}, {0xBC,0xBF,1}, {0x80,0x84,1}, {0x87,0x88,1},
+		{0x8B,0x8E,1}, {0x97,0x97,1}, {0x9C,0x9D,1}, {0x9F,0xA3,1}, {0xA6,0xB1,1}, {0xBC,0xBC,1}, {0xBE,0xBE,1}, {0x81,0x83,1},
+		{0x85,0x8A,1}, {0x8F,0x90,1}, {0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB3,1}, {0xB5,0xB6,1}, {0xB8,0xB9,1}, {0xBC,0xBC,1},
+		{0xBE,0xBF,1}, {0x80,0x82,1}, {0x87,0x88,1}, {0x8B,0x8D,1}, {0x91,0x91,1}, {0x99,0x9C,1}, {0x9E,0x9E,1}, {0xA6,0xB5,1},
+		{0x81,0x83,1}, {0x85,0x8D,1}, {0x8F,0x91,1}, {0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB3,1}, {0xB5,0xB9,1}, {0xBC,0xBF,1},
+		{0x80,0x85,1}, {0x87,0x89,1}, {0x8B,0x8D,1}, {0x90,0x90,1}, {0xA0,0xA3,1}, {0xA6,0xAF,1}, {0xB9,0xBF,1}, {0x81,0x83,1},
+		{0x85,0x8C,1}, {0x8F,0x90,1}, {0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB3,1}, {0xB5,0xB9,1}, {0xBC,0xBF,1}, {0x80,0x84,1},
+		{0x87,0x88,1}, {0x8B,0x8D,1}, {0x95,0x97,1}, {0x9C,0x9D,1}, {0x9F,0xA3,1}, {0xA6,0xAF,1}, {0xB1,0xB1,1}, {0x82,0x83,1},
+		{0x85,0x8A,1}, {0x8E,0x90,1}, {0x92,0x95,1}, {0x99,0x9A,1}, {0x9C,0x9C,1}, {0x9E,0x9F,1}, {0xA3,0xA4,1}, {0xA8,0xAA,1},
+		{0xAE,0xB9,1}, {0xBE,0xBF,1}, {0x80,0x82,1}, {0x86,0x88,1}, {0x8A,0x8D,1}, {0x90,0x90,1}, {0x97,0x97,1}, {0xA6,0xAF,1},
+		{0x80,0x8C,1}, {0x8E,0x90,1}, {0x92,0xA8,1}, {0xAA,0xB9,1}, {0xBC,0xBF,1}, {0x80,0x84,1}, {0x86,0x88,1}, {0x8A,0x8D,1},
+		{0x95,0x96,1}, {0x98,0x9A,1}, {0x9D,0x9D,1}, {0xA0,0xA3,1}, {0xA6,0xAF,1}, {0x80,0x83,1}, {0x85,0x8C,1}, {0x8E,0x90,1},
+		{0x92,0xA8,1}, {0xAA,0xB3,1}, {0xB5,0xB9,1}, {0xBC,0xBF,1}, {0x80,0x84,1}, {0x86,0x88,1}, {0x8A,0x8D,1}, {0x95,0x96,1},
+		{0x9D,0x9E,1}, {0xA0,0xA3,1}, {0xA6,0xAF,1}, {0xB1,0xB2,1}, {0x80,0x8C,1}, {0x8E,0x90,1}, {0x92,0xBF,1}, {0x80,0x84,1},
+		{0x86,0x88,1}, {0x8A,0x8E,1}, {0x94,0x97,1}, {0x9F,0xA3,1}, {0xA6,0xAF,1}, {0xBA,0xBF,1}, {0x81,0x83,1}, {0x85,0x96,1},
+		{0x9A,0xB1,1}, {0xB3,0xBB,1}, {0xBD,0xBD,1}, {0x80,0x86,1}, {0x8A,0x8A,1}, {0x8F,0x94,1}, {0x96,0x96,1}, {0x98,0x9F,1},
+		{0xA6,0xAF,1}, {0xB2,0xB3,1}, {0x81,0xBA,1}, {0x80,0x8E,1}, {0x90,0x99,1}, {0x81,0x82,1}, {0x84,0x84,1}, {0x86,0x8A,1},
+		{0x8C,0xA3,1}, {0xA5,0xA5,1}, {0xA7,0xBD,1}, {0x80,0x84,1}, {0x86,0x86,1}, {0x88,0x8D,1}, {0x90,0x99,1}, {0x9C,0x9F,1},
+		{0x80,0x80,1}, {0x98,0x99,1}, {0xA0,0xA9,1}, {0xB5,0xB5,1}, {0xB7,0xB7,1}, {0xB9,0xB9,1}, {0xBE,0xBF,1}, {0x80,0x87,1},
+		{0x89,0xAC,1}, {0xB1,0xBF,1}, {0x80,0x84,1}, {0x86,0x97,1}, {0x99,0xBC,1}, {0x86,0x86,1}, {0x80,0x80,4}, {0x81,0x81,327},
+		{0x82,0x82,117}, {0x83,0x83,56}, {0x84,0x88,4}, {0x89,0x89,57}, {0x8A,0x8A,58}, {0x8B,0x8B,59}, {0x8C,0x8C,60}, {0x8D,0x8D,328},
+		{0x8E,0x8E,62}, {0x8F,0x8F,63}, {0x90,0x90,64}, {0x91,0x98,4}, {0x99,0x99,65}, {0x9A,0x9A,66}, {0x9B,0x9B,67}, {0x9C,0x9C,329},
+		{0x9D,0x9D,330}, {0x9E,0x9E,4}, {0x9F,0x9F,331}, {0xA0,0xA0,332}, {0xA1,0xA1,72}, {0xA2,0xA2,333}, {0xA3,0xA3,74}, {0xA4,0xA4,334},
+		{0xA5,0xA5,335}, {0xA6,0xA6,77}, {0xA7,0xA7,336}, {0xA8,0xA8,337}, {0xA9,0xA9,338}, {0xAA,0xAA,339}, {0xAB,0xAB,340}, {0xAC,0xAC,4},
+		{0xAD,0xAD,341}, {0xAE,0xAE,4}, {0xAF,0xAF,70}, {0xB0,0xB0,242}, {0xB1,0xB1,342}, {0xB2,0xB2,87}, {0xB3,0xB3,343}, {0xB4,0xBB,4},
+		{0xBC,0xBC,89}, {0xBD,0xBD,90}, {0xBE,0xBE,91}, {0xBF,0xBF,92}, {0x80,0x89,1}, {0x90,0xBF,1}, {0x80,0x9A,1}, {0x9D,0x9F,1},
+		{0xA9,0xB1,1}, {0x80,0x95,1}, {0x9F,0xB4,1}, {0x80,0x93,1}, {0xA0,0xAC,1}, {0xAE,0xB0,1}, {0xB2,0xB3,1}, {0x80,0x93,1},
+		{0x97,0x97,1}, {0x9C,0x9D,1}, {0xA0,0xA9,1}, {0x8B,0x8D,1}, {0x8F,0x99,1}, {0xA0,0xBF,1}, {0x80,0xAA,1}, {0xB0,0xBF,1},
+		{0x80,0x9E,1}, {0xA0,0xAB,1}, {0xB0,0xBB,1}, {0x86,0xAD,1}, {0xB0,0xB4,1}, {0x80,0x89,1}, {0x90,0x9A,1}, {0x80,0x9B,1},
+		{0xA0,0xBF,1}, {0x80,0x9E,1}, {0xA0,0xBC,1}, {0xBF,0xBF,1}, {0x80,0x89,1}, {0x90,0x99,1}, {0xA7,0xA7,1}, {0xB0,0xBD,1},
+		{0xBF,0xBF,1}, {0x80,0x8E,1}, {0x80,0x8C,1}, {0x90,0x99,1}, {0xAB,0xB3,1}, {0x80,0x89,1}, {0x8D,0xBD,1}, {0x90,0x92,1},
+		{0x94,0xBA,1}, {0x80,0x80,345}, {0x81,0x81,346}, {0x82,0x82,95}, {0x83,0x83,347}, {0x84,0x84,96}, {0x85,0x85,97}, {0x86,0x86,12},
+		{0xB0,0xB2,4}, {0xB3,0xB3,348}, {0xB4,0xB4,99}, {0xB5,0xB5,349}, {0xB6,0xB6,101}, {0xB7,0xB7,350}, {0xBF,0xBF,1}, {0x80,0x80,1},
+		{0x94,0x94,1}, {0xB1,0xB1,1}, {0xBF,0xBF,1}, {0x90,0x9C,1}, {0xA1,0xA1,1}, {0xA5,0xB0,1}, {0x80,0xA4,1}, {0xAB,0xB3,1},
+		{0x80,0xA7,1}, {0xAF,0xAF,1}, {0xBF,0xBF,1}, {0x80,0x86,1}, {0x88,0x8E,1}, {0x90,0x96,1}, {0x98,0x9E,1}, {0xA0,0xBF,1},
+		{0x80,0x80,352}, {0x81,0x81,64}, {0x82,0x82,353}, {0x83,0x83,106}, {0x84,0x84,107}, {0x85,0x85,4}, {0x86,0x86,108}, {0x87,0x87,109},
+		{0x90,0xBF,4}, {0x85,0x87,1}, {0xA1,0xAF,1}, {0xB1,0xB5,1}, {0xB8,0xBC,1}, {0x80,0x96,1}, {0x99,0x9A,1}, {0x9D,0x9F,1},
+		{0xA1,0xBF,1}, {0x80,0x91,4}, {0x92,0x92,113}, {0x93,0x93,114}, {0x94,0x97,4}, {0x98,0x98,355}, {0x99,0x99,356}, {0x9A,0x9A,4},
+		{0x9B,0x9B,144}, {0x9C,0x9C,119}, {0x9D,0x9D,4}, {0x9E,0x9E,120}, {0x9F,0x9F,121}, {0xA0,0xA0,357}, {0xA1,0xA1,70}, {0xA2,0xA2,4},
+		{0xA3,0xA3,358}, {0xA4,0xA4,140}, {0xA5,0xA5,359}, {0xA6,0xA6,4}, {0xA7,0xA7,360}, {0xA8,0xA8,173}, {0xA9,0xA9,361}, {0xAA,0xAA,4},
+		{0xAB,0xAB,362}, {0xAC,0xAC,133}, {0xAD,0xAD,134}, {0xAE,0xAE,4}, {0xAF,0xAF,363}, {0xB0,0xBF,4}, {0x80,0x8C,1}, {0x90,0xAB,1},
+		{0x80,0xAF,1}, {0xB4,0xBD,1}, {0xBF,0xBF,1}, {0x80,0xA7,1}, {0xAC,0xAC,1}, {0x80,0x85,1}, {0x90,0x99,1}, {0xA0,0xB7,1},
+		{0xBB,0xBB,1}, {0xBD,0xBF,1}, {0x80,0x93,1}, {0xA0,0xBC,1}, {0x80,0x80,1}, {0x8F,0x99,1}, {0xA0,0xBE,1}, {0x80,0x8D,1},
+		{0x90,0x99,1}, {0xA0,0xB6,1}, {0xBA,0xBF,1}, {0x80,0x82,1}, {0x9B,0x9D,1}, {0xA0,0xAF,1}, {0xB2,0xB6,1}, {0x80,0xAA,1},
+		{0xAC,0xAD,1}, {0xB0,0xB9,1}, {0xA4,0xA8,4}, {0xA9,0xA9,140}, {0xAA,0xAA,4}, {0xAB,0xAB,141}, {0xAC,0xAC,365}, {0xAD,0xAD,143},
+		{0xAE,0xAE,144}, {0xAF,0xAF,145}, {0xB0,0xB0,4}, {0xB1,0xB1,146}, {0xB2,0xB3,4}, {0xB4,0xB4,147}, {0xB5,0xB5,148}, {0xB6,0xB6,149},
+		{0xB7,0xB7,150}, {0xB8,0xB8,366}, {0xB9,0xB9,367}, {0xBA,0xBA,4}, {0xBB,0xBB,152}, {0xBC,0xBC,368}, {0xBD,0xBD,154}, {0xBE,0xBE,235},
+		{0xBF,0xBF,156}, {0x80,0x86,1}, {0x93,0x97,1}, {0x9D,0xA8,1}, {0xAA,0xB6,1}, {0xB8,0xBC,1}, {0xBE,0xBE,1}, {0x80,0x8F,1},
+		{0xA0,0xAF,1}, {0xB3,0xB4,1}, {0x8D,0x8F,1}, {0xB1,0xB1,1}, {0xB3,0xB3,1}, {0xB7,0xB7,1}, {0xB9,0xB9,1}, {0xBB,0xBB,1},
+		{0xBD,0xBD,1}, {0xBF,0xBF,1}, {0x90,0x99,1}, {0xA1,0xBA,1}, {0xBF,0xBF,1}, {0x90,0x90,370}, {0x91,0x91,380}, {0x92,0x92,228},
+		{0x93,0x93,231}, {0x94,0x94,232}, {0x96,0x96,409}, {0x97,0x97,111}, {0x98,0x98,241}, {0x9A,0x9A,244}, {0x9B,0x9B,416}, {0x9C,0x9C,418},
+		{0x9D,0x9D,419}, {0x9E,0x9E,427}, {0x9F,0x9F,435}, {0xA0,0xA9,111}, {0xAA,0xAA,272}, {0xAB,0xAB,274}, {0xAC,0xAC,275}, {0xAD,0xAD,111},
+		{0xAE,0xAE,277}, {0xAF,0xAF,279}, {0xB0,0xB0,111}, {0xB1,0xB1,281}, {0x80,0x80,159}, {0x81,0x81,160}, {0x82,0x82,4}, {0x83,0x83,161},
+		{0x85,0x85,162}, {0x87,0x87,371}, {0x8A,0x8A,163}, {0x8B,0x8B,372}, {0x8C,0x8C,165}, {0x8D,0x8D,373}, {0x8E,0x8E,117}, {0x8F,0x8F,167},
+		{0x90,0x91,4}, {0x92,0x92,374}, {0x93,0x93,169}, {0x94,0x94,170}, {0x95,0x95,171}, {0x96,0x96,172}, {0x98,0x9B,4}, {0x9C,0x9C,173},
+		{0x9D,0x9D,174}, {0x9E,0x9E,175}, {0xA0,0xA0,176}, {0xA1,0xA1,177}, {0xA2,0xA2,75}, {0xA3,0xA3,178}, {0xA4,0xA4,179}, {0xA6,0xA6,180},
+		{0xA8,0xA8,375}, {0xA9,0xA9,182}, {0xAA,0xAA,183}, {0xAB,0xAB,376}, {0xAC,0xAC,74}, {0xAD,0xAD,185}, {0xAE,0xAE,186}, {0xB0,0xB0,4},
+		{0xB1,0xB1,12}, {0xB2,0xB3,187}, {0xB4,0xB4,377}, {0xBA,0xBA,378}, {0xBC,0xBC,189}, {0xBD,0xBD,379}, {0xBE,0xBE,190}, {0xBF,0xBF,192},
+		{0xBD,0xBD,1}, {0x80,0x90,1}, {0xA0,0xA0,1}, {0x80,0x8A,1}, {0x90,0xBA,1}, {0x80,0x9D,1}, {0xA0,0xA9,1}, {0xB0,0xBF,1},
+		{0x80,0x83,1}, {0x85,0x86,1}, {0x8C,0x93,1}, {0x95,0x97,1}, {0x99,0xB5,1}, {0xB8,0xBA,1}, {0xBF,0xBF,1}, {0x80,0x87,1},
+		{0x89,0xA6,1}, {0x80,0xA7,1}, {0xB0,0xB9,1}, {0x80,0xA9,1}, {0xAB,0xAC,1}, {0xB0,0xB1,1}, {0x80,0x90,1}, {0xB0,0xBF,1},
+		{0x80,0x80,4}, {0x81,0x81,381}, {0x82,0x82,161}, {0x83,0x83,382}, {0x84,0x84,383}, {0x85,0x85,384}, {0x86,0x86,4}, {0x87,0x87,385},
+		{0x88,0x88,386}, {0x8A,0x8A,203}, {0x8B,0x8B,387}, {0x8C,0x8C,388}, {0x8D,0x8D,389}, {0x90,0x90,4}, {0x91,0x91,390}, {0x92,0x92,4},
+		{0x93,0x93,391}, {0x96,0x96,392}, {0x97,0x97,393}, {0x98,0x98,4}, {0x99,0x99,394}, {0x9A,0x9A,72}, {0x9B,0x9B,25}, {0x9C,0x9C,395},
+		{0x9D,0x9D,45}, {0xA0,0xA0,161}, {0xA2,0xA2,14}, {0xA3,0xA3,396}, {0xA4,0xA4,397}, {0xA5,0xA5,398}, {0xA6,0xA6,215}, {0xA7,0xA7,399},
+		{0xA8,0xA8,235}, {0xA9,0xA9,400}, {0xAA,0xAA,401}, {0xAB,0xAB,72}, {0xB0,0xB0,402}, {0xB1,0xB1,403}, {0xB2,0xB2,404}, {0xB4,0xB4,405},
+		{0xB5,0xB5,406}, {0xB6,0xB6,407}, {0xBB,0xBB,408}, {0xBE,0xBE,227}, {0x80,0x86,1}, {0xA6,0xB5,1}, {0xBF,0xBF,1}, {0x82,0x82,1},
+		{0x90,0xA8,1}, {0xB0,0xB9,1}, {0x80,0xB4,1}, {0xB6,0xBF,1}, {0x84,0x87,1}, {0x90,0xB3,1}, {0xB6,0xB6,1}, {0x80,0x84,1},
+		{0x89,0x8C,1}, {0x8E,0x9A,1}, {0x9C,0x9C,1}, {0x80,0x91,1}, {0x93,0xB7,1}, {0xBE,0xBE,1}, {0x80,0xAA,1}, {0xB0,0xB9,1},
+		{0x80,0x83,1}, {0x85,0x8C,1}, {0x8F,0x90,1}, {0x93,0xA8,1}, {0xAA,0xB0,1}, {0xB2,0xB3,1}, {0xB5,0xB9,1}, {0xBB,0xBF,1},
+		{0x80,0x84,1}, {0x87,0x88,1}, {0x8B,0x8D,1}, {0x90,0x90,1}, {0x97,0x97,1}, {0x9D,0xA3,1}, {0xA6,0xAC,1}, {0xB0,0xB4,1},
+		{0x80,0x8A,1}, {0x90,0x99,1}, {0x9E,0xA1,1}, {0x80,0x85,1}, {0x87,0x87,1}, {0x90,0x99,1}, {0x80,0xB5,1}, {0xB8,0xBF,1},
+		{0x80,0x80,1}, {0x98,0x9D,1}, {0x80,0x80,1}, {0x84,0x84,1}, {0x90,0x99,1}, {0x80,0x9A,1}, {0x9D,0xAB,1}, {0xB0,0xB9,1},
+		{0x80,0xA9,1}, {0xBF,0xBF,1}, {0x80,0x86,1}, {0x89,0x89,1}, {0x8C,0x93,1}, {0x95,0x96,1}, {0x98,0xB5,1}, {0xB7,0xB8,1},
+		{0xBB,0xBF,1}, {0x80,0x83,1}, {0x90,0x99,1}, {0x80,0x97,1}, {0x9A,0xA1,1}, {0xA3,0xA4,1}, {0x87,0x87,1}, {0x90,0xBF,1},
+		{0x80,0x99,1}, {0x9D,0x9D,1}, {0xB0,0xBF,1}, {0x80,0x88,1}, {0x8A,0xB6,1}, {0xB8,0xBF,1}, {0x80,0x80,1}, {0x90,0x99,1},
+		{0xB2,0xBF,1}, {0x80,0x8F,1}, {0x92,0xA7,1}, {0xA9,0xB6,1}, {0x80,0x86,1}, {0x88,0x89,1}, {0x8B,0xB6,1}, {0xBA,0xBA,1},
+		{0xBC,0xBD,1}, {0xBF,0xBF,1}, {0x80,0x87,1}, {0x90,0x99,1}, {0xA0,0xA5,1}, {0xA7,0xA8,1}, {0xAA,0xBF,1}, {0x80,0x8E,1},
+		{0x90,0x91,1}, {0x93,0x98,1}, {0xA0,0xA9,1}, {0xA0,0xB6,1}, {0xA0,0xA7,4}, {0xA8,0xA8,72}, {0xA9,0xA9,410}, {0xAA,0xAA,235},
+		{0xAB,0xAB,411}, {0xAC,0xAC,173}, {0xAD,0xAD,412}, {0xAE,0xAE,222}, {0xB9,0xB9,4}, {0xBC,0xBC,4}, {0xBD,0xBD,413}, {0xBE,0xBE,414},
+		{0xBF,0xBF,415}, {0x80,0x9E,1}, {0xA0,0xA9,1}, {0xB0,0xBF,1}, {0x80,0x89,1}, {0x90,0xAD,1}, {0xB0,0xB4,1}, {0x80,0x83,1},
+		{0x90,0x99,1}, {0xA3,0xB7,1}, {0xBD,0xBF,1}, {0x80,0x8A,1}, {0x8F,0xBF,1}, {0x80,0x87,1}, {0x8F,0x9F,1}, {0xA0,0xA1,1},
+		{0xA3,0xA4,1}, {0xB0,0xB1,1}, {0x80,0x83,4}, {0x84,0x84,135}, {0x85,0x85,247}, {0x86,0x8A,4}, {0x8B,0x8B,248}, {0xB0,0xB0,4},
+		{0xB1,0xB1,249}, {0xB2,0xB2,417}, {0x80,0x88,1}, {0x90,0x99,1}, {0x9D,0x9E,1}, {0xBC,0xBC,140}, {0xBD,0xBD,45}, {0x85,0x85,420},
+		{0x86,0x86,421}, {0x89,0x89,422}, {0x90,0x90,4}, {0x91,0x91,252}, {0x92,0x92,253}, {0x93,0x93,254}, {0x94,0x94,255}, {0x95,0x95,256},
+		{0x96,0x99,4}, {0x9A,0x9A,257}, {0x9B,0x9B,258}, {0x9C,0x9C,259}, {0x9D,0x9D,260}, {0x9E,0x9E,261}, {0x9F,0x9F,423}, {0xA8,0xA8,424},
+		{0xA9,0xA9,425}, {0xAA,0xAA,426}, {0xBC,0xBC,75}, {0xA5,0xA9,1}, {0xAD,0xB2,1}, {0xBB,0xBF,1}, {0x80,0x82,1}, {0x85,0x8B,1},
+		{0xAA,0xAD,1}, {0x82,0x84,1}, {0x80,0x82,1}, {0x84,0x8B,1}, {0x8E,0xBF,1}, {0x80,0xB6,1}, {0xBB,0xBF,1}, {0x80,0xAC,1},
+		{0xB5,0xB5,1}, {0x84,0x84,1}, {0x9B,0x9F,1}, {0xA1,0xAF,1}, {0x80,0x80,428}, {0x84,0x84,429}, {0x85,0x85,430}, {0x8A,0x8A,431},
+		{0x8B,0x8B,432}, {0x9F,0x9F,266}, {0xA0,0xA2,4}, {0xA3,0xA3,433}, {0xA4,0xA4,4}, {0xA5,0xA5,434}, {0xB8,0xB8,269}, {0xB9,0xB9,270},
+		{0xBA,0xBA,271}, {0x80,0x86,1}, {0x88,0x98,1}, {0x9B,0xA1,1}, {0xA3,0xA4,1}, {0xA6,0xAA,1}, {0x80,0xAC,1}, {0xB0,0xBD,1},
+		{0x80,0x89,1}, {0x8E,0x8E,1}, {0x90,0xAE,1}, {0x80,0xB9,1}, {0x80,0x84,1}, {0x90,0x96,1}, {0x80,0x8B,1}, {0x90,0x99,1},
+		{0xAF,0xAF,436}, {0xB0,0xB9,1}, {0xA0,0xA0,438}, {0x84,0x86,4}, {0x87,0x87,118},
+	};
+
+} // STRM::IMPL::XID
+
+#endif
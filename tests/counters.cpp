@@ -0,0 +1,148 @@
+#define STRM_COUNTERS
+#include <strm/parallel.hpp>
+#include <strm/source.hpp>
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+struct recorder : strm::counter_sink
+{
+	void record(const strm::match_event& e) override { events.push_back(e); }
+	
+	std::vector<strm::match_event> events;
+};
+
+template <class... Options>
+int match_some(std::string_view& src)
+{
+	return strm::match<Options...>(src,
+		-1,
+		strm::lit<"===">  >> 0,
+		strm::lit<"=">    >> 1,
+		strm::int_num     >> 2
+	);
+}
+
+template <class... Options>
+void test_counters_with()
+{
+	recorder r;
+	strm::set_counter_sink(&r);
+	
+	std::string_view src = "123==$";
+	
+	assert( match_some<Options...>(src) == 2 );
+	assert( match_some<Options...>(src) == 1 ); // reads "==", then falls back to "="
+	assert( match_some<Options...>(src) == 1 );
+	assert( match_some<Options...>(src) == -1 );
+	
+	assert( r.events.size() == 4 );
+	
+	auto check = [&] (std::size_t k, int index, std::size_t length, std::size_t backtrack) {
+		const auto& e = r.events[k];
+		return e.cases == r.events[0].cases && e.index == index && e.length == length && e.backtrack == backtrack;
+	};
+	
+	assert( check(0, 2, 3, 0) );
+	assert( check(1, 1, 1, 1) );
+	assert( check(2, 1, 1, 0) );
+	assert( check(3, -1, 0, 0) );
+	
+	// a match in an action is reported on its own
+	r.events.clear();
+	src = "12 ab";
+	
+	auto inner = [] (std::string_view s) { 
+		return strm::match<Options...>(s, -1, strm::int_num >> 4, strm::identifier >> 5); 
+	};
+	
+	assert( strm::match<Options...>(src, -1, strm::int_num >> [&] { return inner("xyz"); }) == 5 );
+	
+	// the inner match ends first
+	assert( r.events.size() == 2 );
+	assert( r.events[0].index == 1 && r.events[0].length == 3 );
+	assert( r.events[1].index == 0 && r.events[1].length == 2 && r.events[1].cases != r.events[0].cases );
+	
+	strm::set_counter_sink(nullptr);
+	match_some<Options...>(src);
+	assert( r.events.size() == 2 );
+}
+
+// the events since the last call : index, length, backtrack
+auto events(recorder& r)
+{
+	std::vector<std::tuple<int, std::size_t, std::size_t>> res;
+	for (const auto& e : r.events)
+		res.emplace_back(e.index, e.length, e.backtrack);
+	r.events.clear();
+	return res;
+}
+
+using event_list = std::vector<std::tuple<int, std::size_t, std::size_t>>;
+
+template <class... Options>
+void test_entry_points_with()
+{
+	recorder r;
+	strm::set_counter_sink(&r);
+	
+	// the skipped characters are reported with the index after the cases
+	auto lexer = strm::make_tokenizer<Options...>(strm::whitespace, -1, strm::lit<"==="> >> 0, strm::lit<"="> >> 1, strm::int_num >> 2);
+	const event_list lexed = { {2, 2, 0}, {3, 1, 0}, {1, 1, 1}, {1, 1, 0}, {-1, 1, 0} };
+	
+	strm::token<int> batch[8];
+	std::size_t pos = 0;
+	assert( strm::tokenize(lexer, "12 ==$", pos, batch) == 4 );
+	assert( events(r) == lexed );
+	
+	assert( strm::parallel_tokenize(lexer, "12 ==$", {.threads = 1}).size() == 4 );
+	assert( events(r) == lexed );
+	
+	// search reports the match it found, find_all every match
+	std::string_view text = "ab 12 c";
+	assert( strm::search<Options...>(text, -1, strm::int_num >> 0).result == 0 );
+	assert( strm::search<Options...>(text, -1, strm::int_num >> 0).result == -1 );
+	assert( (events(r) == event_list{ {0, 2, 0}, {-1, 0, 0} }) );
+	
+	strm::find_all<Options...>(std::string_view{"1 22 333"}, [] (auto) {}, strm::int_num >> 0);
+	assert( (events(r) == event_list{ {0, 1, 0}, {0, 2, 0}, {0, 3, 0} }) );
+	
+	// the inputs of a batch finish in any order
+	std::string_view cells[] = { "12x", "==$", "$" };
+	int results[3];
+	strm::match_batch<Options...>(cells, results, -1, strm::lit<"==="> >> 0, strm::lit<"="> >> 1, strm::int_num >> 2);
+	
+	auto batched = events(r);
+	std::ranges::sort(batched);
+	assert( (batched == event_list{ {-1, 0, 0}, {1, 1, 1}, {2, 2, 0} }) );
+	
+	// a match retried after reading more input is reported once
+	std::istringstream in{"12==$"};
+	strm::buffered_source src{in, 1};
+	
+	auto match_source = [&] {
+		return strm::match<Options...>(src, -1, strm::lit<"==="> >> 0, strm::lit<"="> >> 1, strm::int_num >> 2);
+	};
+	while (match_source() != -1) {}
+	assert( (events(r) == event_list{ {2, 2, 0}, {1, 1, 1}, {1, 1, 0}, {-1, 0, 0} }) );
+	
+	// a resumable match, over two buffers
+	auto m = strm::make_resumable<Options...>(-1, strm::lit<"==="> >> 0, strm::lit<"="> >> 1);
+	std::string_view first = "==", second = "$";
+	assert( not m.feed(first) && m.feed(second) == 1 );
+	assert( (events(r) == event_list{ {1, 1, 1} }) );
+	
+	strm::set_counter_sink(nullptr);
+}
+
+int main()
+{
+	test_counters_with();
+	test_counters_with<strm::table_backend>();
+	
+	test_entry_points_with();
+	test_entry_points_with<strm::table_backend>();
+}
@@ -0,0 +1,41 @@
+#include <strm/debug.hpp>
+#include <cassert>
+#include <sstream>
+#include <string>
+
+void test_stats()
+{
+	// the start, a run of digits, and the two states of "ab"
+	constexpr auto s = strm::stats<strm::lit<"ab">, strm::int_num>;
+	
+	static_assert( s.states == 4 );
+	static_assert( s.classes == 4 );           // digits, 'a', 'b', and the rest
+	static_assert( s.transitions == 10 + 1 + 10 + 1 );
+	static_assert( s.max_range == 'a' - '0' + 1 );
+	static_assert( s.table_bytes >= 256 + 5 * 4 );
+	
+	// a keyword shadowed by an identifier adds its own states
+	static_assert( strm::stats<strm::lit<"if">, strm::identifier>.states == 4 );
+	static_assert( strm::stats<strm::identifier>.states == 2 );
+}
+
+void test_dot()
+{
+	std::ostringstream out;
+	strm::write_dot<strm::lit<"a\"b">, strm::int_num>(out);
+	
+	const auto dot = out.str();
+	
+	assert( dot.starts_with("digraph strm {\n") && dot.ends_with("}\n") );
+	assert( dot.find("\tstart -> 1;\n") != std::string::npos );
+	assert( dot.find("\t1 -> 2 [label=\"[0-9]\"];\n") != std::string::npos );
+	assert( dot.find("\t2 -> 2 [label=\"[0-9]\"];\n") != std::string::npos );
+	assert( dot.find("\t2 [shape=doublecircle, label=\"2\\n1\"];\n") != std::string::npos );
+	assert( dot.find("\t3 -> 4 [label=\"\\\"\"];\n") != std::string::npos );
+}
+
+int main()
+{
+	test_stats();
+	test_dot();
+}
@@ -0,0 +1,129 @@
+#include <strm/dynamic.hpp>
+#include <cassert>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// the same cases as a compile-time match
+auto match_static(const char* str)
+{
+	auto i = str;
+
+	auto r = strm::match(i,
+		-1,
+		strm::lit<"if">                                 >> 0,
+		strm::lit<"while">                              >> 1,
+		strm::re<"[0-9]+(\\.[0-9]*)?([eE][+-]?[0-9]+)?"> >> 2,
+		strm::re<"0[xX][0-9a-fA-F]+">                   >> 3,
+		strm::re<"\"([^\"\\\\]|\\\\.)*\"">              >> 4,
+		strm::re<"[a-zA-Z_][a-zA-Z_0-9]*">              >> 5,
+		strm::lit<"==">                                 >> 6,
+		strm::lit<"=">                                  >> 7
+	);
+
+	return std::pair{r, i - str};
+}
+
+void test_match()
+{
+	const strm::dynamic_matcher<int> m{-1, {
+		strm::runtime_lit("if")                                 >> 0,
+		strm::runtime_lit("while")                              >> 1,
+		strm::runtime_re("[0-9]+(\\.[0-9]*)?([eE][+-]?[0-9]+)?") >> 2,
+		strm::runtime_re("0[xX][0-9a-fA-F]+")                   >> 3,
+		strm::runtime_re("\"([^\"\\\\]|\\\\.)*\"")              >> 4,
+		strm::runtime_re("[a-zA-Z_][a-zA-Z_0-9]*")              >> 5,
+		strm::runtime_lit("==")                                 >> 6,
+		strm::runtime_lit("=")                                  >> 7
+	}};
+
+	for (auto str : {"if", "iffy", "while(", "12.5e+3x", "1e", "0x1fz", "\"a\\\"b\" c", "\"open",
+	                 "===", "=", "$", ""})
+	{
+		auto i = str;
+		const int r = m.match(i);
+		assert( std::pair(r, i - str) == match_static(str) );
+	}
+}
+
+void test_inputs()
+{
+	const strm::dynamic_matcher<std::string> m{"none", {
+		strm::runtime_lit("GET")  >> std::string("get"),
+		strm::runtime_lit("POST") >> std::string("post"),
+		strm::runtime_re("[A-Z]+") >> std::string("method")
+	}};
+
+	std::string_view sv = "POSTS /";
+	assert( m.match(sv) == "method" && sv == " /" );
+
+	sv = "GET /";
+	assert( m.match(sv) == "get" && sv == " /" );
+
+	// a range may contain zero bytes, and stops the match at its end
+	const std::string str{"POST\0x", 6};
+	auto it = str.begin();
+	assert( m.match(it, str.begin() + 3) == "method" && it == str.begin() + 3 );
+	it = str.begin();
+	assert( m.match(it, str.end()) == "post" && it == str.begin() + 4 );
+
+	sv = "get";
+	assert( m.match(sv) == "none" && sv == "get" );
+
+	// a literal may contain zero bytes, which only match in ranges
+	const strm::dynamic_matcher<int> z{-1, {
+		strm::runtime_lit(std::string_view("a\0b", 3)) >> 0,
+		strm::runtime_lit("a")                         >> 1
+	}};
+
+	std::string_view bytes{"a\0bc", 4};
+	assert( z.match(bytes) == 0 && bytes == "c" );
+
+	const char* terminated = "a\0b";
+	assert( z.match(terminated) == 1 && *terminated == '\0' );
+}
+
+void test_build()
+{
+	// the literals are built from a list only known at runtime
+	std::vector<strm::dynamic_case<int>> cases;
+	for (auto w : {"alpha", "beta", "gamma", "delta"})
+		cases.push_back( strm::runtime_lit(w) >> static_cast<int>(cases.size()) );
+
+	const strm::dynamic_matcher<int> m{-1, cases};
+
+	std::string_view sv = "gammadelta";
+	assert( m.match(sv) == 2 && m.match(sv) == 3 && sv.empty() );
+
+	// the automaton is minimal : "ab" and "cb" share their last states
+	const strm::dynamic_matcher<int> shared{-1, {
+		strm::runtime_lit("ab") >> 0,
+		strm::runtime_lit("cb") >> 0
+	}};
+	assert( shared.states() == 4 );
+
+	// a literal isn't a regular expression
+	const strm::dynamic_matcher<int> lit{-1, { strm::runtime_lit("a+") >> 0 }};
+	sv = "a+";
+	assert( lit.match(sv) == 0 && sv.empty() );
+
+	for (auto pattern : {"(a", "a)", "*a", "[a-", "a{2,1}", "\\x4"})
+	{
+		bool thrown = false;
+		try {
+			strm::dynamic_matcher<int> bad{-1, { strm::runtime_re(pattern) >> 0 }};
+		}
+		catch (const strm::regex_syntax_error&) {
+			thrown = true;
+		}
+		assert( thrown );
+	}
+}
+
+int main()
+{
+	test_match();
+	test_inputs();
+	test_build();
+}
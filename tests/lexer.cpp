@@ -1,6 +1,8 @@
 
 #include <strm/strm.hpp>
 #include <cassert> 
+#include <string_view>
+#include <iterator>
 
 enum class tok : unsigned char {
 	#define KW(N) N##_,
@@ -15,6 +17,7 @@ enum class tok : unsigned char {
 	invalid
 };
 
+template <class Backend>
 struct TokenStream {
 
 	void scan()
@@ -35,7 +38,7 @@ struct TokenStream {
 		// caution : the "identifier" matcher should appear last!
 		// otherwise it will take precedence over all the keywords
 		
-		tok_ = strm::match(
+		tok_ = strm::match<Backend>(
 			it,
 			tok::invalid,
 			#include "lex.def"
@@ -52,8 +55,8 @@ struct TokenStream {
 	tok tok_ = tok::invalid;
 };
 
-template <unsigned N>
-void test_token_stream(TokenStream& it, tok(&&tokens)[N])
+template <class Backend, unsigned N>
+void test_token_stream(TokenStream<Backend>& it, tok(&&tokens)[N])
 {
 	int z = 0;
 	for (auto k : tokens)
@@ -64,11 +67,12 @@ void test_token_stream(TokenStream& it, tok(&&tokens)[N])
 	}
 }
 
-int main(){
-	
+template <class Backend>
+void test_backend()
+{
 	const char* src = "struct { int x; float y; }; template <int Z> void foo(){} ";
 	
-	auto iter = TokenStream{src};
+	auto iter = TokenStream<Backend>{src};
 	iter.scan();
 	
 	test_token_stream(
@@ -82,4 +86,56 @@ int main(){
 		 tok::lbrace, tok::rbrace
 		}
 	);
+}
+
+template <class Backend>
+void test_tokenizer()
+{
+	#define KW(N)         strm::lit<STR(N)>  >> tok::N##_,
+	#define SYM(S, NAME)  strm::lit<S>  >> tok::NAME,
+	
+	auto lexer = strm::make_tokenizer<Backend>(
+		strm::whitespace,
+		tok::invalid,
+		#include "lex.def"
+		strm::identifier >> tok::id
+	);
+	
+	#undef KW
+	#undef SYM
+	
+	std::string_view src = "struct { int x; }; $ foo(){}  ";
+	
+	tok expected[] = {
+		tok::struct_, tok::lbrace, tok::int_, tok::id, tok::semicolon, 
+		tok::rbrace, tok::semicolon, tok::invalid, tok::id, 
+		tok::lparens, tok::rparens, tok::lbrace, tok::rbrace
+	};
+	
+	// a small batch, so that the input takes several calls
+	strm::token<tok> batch[4];
+	std::size_t pos = 0;
+	std::size_t k = 0;
+	
+	while (auto n = strm::tokenize(lexer, src, pos, batch))
+	{
+		for (auto& t : std::span(batch, n))
+		{
+			assert( t.kind == expected[k++] );
+			
+			if (t.kind == tok::id)
+				assert( src.substr(t.offset, t.length) == (k == 4 ? "x" : "foo") );
+		}
+	}
+	
+	assert( k == std::size(expected) );
+	assert( pos == src.size() );
+}
+
+int main(){
+	test_backend<strm::switch_backend>();
+	test_backend<strm::table_backend>();
+	
+	test_tokenizer<strm::switch_backend>();
+	test_tokenizer<strm::table_backend>();
 }
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <strm/parallel.hpp>
+#include <cassert>
+#include <string>
+#include <vector>
+
+enum class tok { kw_int, kw_return, id, num, lparens, rparens, semicolon, assign, plus, invalid };
+
+auto make_lexer()
+{
+	return strm::make_tokenizer(
+		strm::whitespace,
+		tok::invalid,
+		strm::lit<"int">    >> tok::kw_int,
+		strm::lit<"return"> >> tok::kw_return,
+		strm::lit<"(">      >> tok::lparens,
+		strm::lit<")">      >> tok::rparens,
+		strm::lit<";">      >> tok::semicolon,
+		strm::lit<"=">      >> tok::assign,
+		strm::lit<"+">      >> tok::plus,
+		strm::identifier    >> tok::id,
+		strm::int_num       >> tok::num
+	);
+}
+
+auto sequential(std::string_view input)
+{
+	auto lexer = make_lexer();
+	
+	std::vector<strm::token<tok>> res;
+	strm::token<tok> batch[64];
+	std::size_t pos = 0;
+	
+	while (auto n = strm::tokenize(lexer, input, pos, batch))
+		res.insert(res.end(), batch, batch + n);
+	
+	return res;
+}
+
+bool same(const std::vector<strm::token<tok>>& a, const std::vector<strm::token<tok>>& b)
+{
+	if (a.size() != b.size())
+		return false;
+	
+	for (std::size_t k = 0; k < a.size(); ++k)
+	{
+		if (a[k].kind != b[k].kind || a[k].offset != b[k].offset || a[k].length != b[k].length)
+			return false;
+	}
+	return true;
+}
+
+int main()
+{
+	// long tokens and runs of whitespace, so that chunks often begin in the middle of one
+	std::string input;
+	for (int k = 0; k < 500; ++k)
+	{
+		input += "int a_long_identifier_" + std::to_string(k) + " = " + std::to_string(k * 7919) + ";\n";
+		input += (k % 3) ? "return (x + 12345678);\n" : "   \n\n   $ ret\n";
+	}
+	
+	const auto expected = sequential(input);
+	const auto lexer = make_lexer();
+	
+	assert( same(expected, strm::parallel_tokenize(lexer, input, {.threads = 4, .chunk_size = 61})) );
+	assert( same(expected, strm::parallel_tokenize(lexer, input, {.threads = 4, .chunk_size = 97, .sync = "\n"})) );
+	assert( same(expected, strm::parallel_tokenize(lexer, input, {.threads = 1, .chunk_size = 1000})) );
+	assert( same(expected, strm::parallel_tokenize(lexer, input, {.chunk_size = 1 << 20})) );
+	
+	assert( strm::parallel_tokenize(lexer, "", {.threads = 2}).empty() );
+}
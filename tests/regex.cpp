@@ -0,0 +1,132 @@
+#include <strm/regex.hpp>
+#include <cassert>
+#include <string_view>
+#include <utility>
+
+constexpr bool matches(auto m, std::string_view str)
+{
+	for (char c : str)
+	{
+		m = m.get_next(c);
+		if (m.status() != strm::running)
+			return false;
+	}
+	return m.accepts();
+}
+
+void test_syntax()
+{
+	static_assert( matches(strm::re<"abc">, "abc") );
+	static_assert( not matches(strm::re<"abc">, "ab") );
+	
+	static_assert( matches(strm::re<"a|bc|">, "bc") );
+	static_assert( matches(strm::re<"a|bc|">, "") );
+	
+	static_assert( matches(strm::re<"(ab)*">, "") );
+	static_assert( matches(strm::re<"(ab)*">, "abab") );
+	static_assert( not matches(strm::re<"(ab)+">, "") );
+	static_assert( matches(strm::re<"colou?r">, "color") );
+	
+	static_assert( matches(strm::re<"a{3}">, "aaa") );
+	static_assert( not matches(strm::re<"a{3}">, "aaaa") );
+	static_assert( matches(strm::re<"(a|b){2,}">, "abba") );
+	static_assert( not matches(strm::re<"(a|b){2,3}">, "abba") );
+	static_assert( matches(strm::re<"x(ab){0}y">, "xy") );
+	
+	static_assert( matches(strm::re<"[a-c_]+">, "a_cb") );
+	static_assert( not matches(strm::re<"[a-c_]+">, "d") );
+	static_assert( matches(strm::re<"[^a-c]">, "d") );
+	static_assert( matches(strm::re<"[]a]+">, "]a") );
+	static_assert( matches(strm::re<"[a-]+">, "-a") );
+	static_assert( matches(strm::re<"\\d\\s\\w\\W">, "1 x.") );
+	static_assert( matches(strm::re<"[\\d.]+">, "1.5") );
+	static_assert( matches(strm::re<"\\x41\\.\\t">, "A.\t") );
+	static_assert( matches(strm::re<".+">, "a b") );
+	static_assert( not matches(strm::re<".">, "\n") );
+	static_assert( matches(strm::re<"a.">, std::string_view{"a\0", 2}) );
+	static_assert( matches(strm::re<"[^a]\\x00">, std::string_view{"\0\0", 2}) );
+	static_assert( not strm::impl::reads_zero<strm::regex_matcher<"[a-z]+">> );
+	static_assert( strm::impl::reads_zero<strm::regex_matcher<"a.">> );
+	
+	// ranges of the characters which continue a match
+	constexpr auto hex = strm::re<"0x[0-9a-f]+">;
+	static_assert( hex.min() == '0' && hex.max() == '0' );
+	static_assert( hex.get_next('0').get_next('x').min() == '0' );
+	static_assert( hex.get_next('0').get_next('x').max() == 'f' );
+	static_assert( hex.can_fail() && not hex.get_next('0').get_next('x').get_next('1').can_fail() );
+}
+
+// both backends must give the same results
+template <class... Options>
+auto match_some(const char* str)
+{
+	auto i = str;
+	
+	auto r = strm::match<Options...>(i, 
+		-1,
+		strm::re<"[0-9]+(\\.[0-9]*)?([eE][+-]?[0-9]+)?"> >> 0,
+		strm::re<"0[xX][0-9a-fA-F]+">                   >> 1,
+		strm::re<"\"([^\"\\\\]|\\\\.)*\"">              >> 2,
+		strm::re<"(ab|cd){2,3}x?">                      >> 3,
+		strm::identifier                                >> 4
+	);
+	
+	return std::pair{r, i - str};
+}
+
+void test_match()
+{
+	std::pair<int, std::ptrdiff_t> expected[] = {
+		{0, 3}, {0, 7}, {0, 1}, {1, 4}, {2, 6}, {2, 7}, {3, 6}, {4, 8}, {3, 5}, {4, 2}, {-1, 13}, {-1, 0}
+	};
+	
+	int k = 0;
+	for (auto str : {"123", "12.5e+3x", "1e", "0x1fz", "\"a\\\"b\" c", "\"\xc3\xa9t\xc3\xa9\"", 
+	                 "abcdab", "abcdabcd", "ababx", "ab", "\"unterminated", "$"})
+	{
+		assert( match_some(str) == expected[k] );
+		assert( match_some<strm::table_backend>(str) == expected[k] );
+		++k;
+	}
+}
+
+// a zero byte is a character of bounded inputs, and the end of NUL-terminated ones
+template <class... Options>
+void test_zero()
+{
+	constexpr char str[] = "a\0\0b";
+	
+	auto zeros = [] (auto& src, auto... end) {
+		return strm::match<Options...>(src, end..., 
+			-1,
+			strm::re<"a.[^a]\\x00?"> >> 0,
+			strm::re<"a">              >> 1
+		);
+	};
+	
+	std::string_view view{str, 4};
+	assert( zeros(view) == 0 && view == "b" );
+	
+	const char* it = str;
+	assert( zeros(it, str + 4) == 0 && it == str + 3 );
+	
+	it = str;
+	assert( zeros(it) == 1 && it == str + 1 );
+	
+	// the same on the search paths
+	it = str;
+	auto found = strm::search<Options...>(it, -1, strm::re<"\\x00."> >> 0);
+	assert( found.result == -1 && it == str + 1 );
+	
+	view = {str, 4};
+	found = strm::search<Options...>(view, -1, strm::re<"\\x00."> >> 0);
+	assert( found.result == 0 && found.text() == std::string_view(str + 1, 2) );
+}
+
+int main()
+{
+	test_syntax();
+	test_match();
+	test_zero();
+	test_zero<strm::table_backend>();
+}
@@ -0,0 +1,280 @@
+#include <strm/source.hpp>
+#include <cassert>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/mman.h>)
+#include <cstdlib>
+#include <unistd.h>
+#define POSIX_SOURCES
+#endif
+
+using tokens = std::vector<std::tuple<int, std::string>>;
+
+// the lexemes are checked through an action, which only runs once per token
+auto next_token(auto& src, std::string& lexeme)
+{
+	auto keep = [&] (int r) {
+		return [&lexeme, r] (std::string_view s) { lexeme = s; return r; };
+	};
+
+	return strm::match(src,
+		-1,
+		strm::whitespace  >> 0,
+		strm::float_num   >> keep(1),
+		strm::int_num     >> keep(2),
+		strm::identifier  >> keep(3),
+		strm::lit<"==">   >> 4,
+		strm::lit<"=">    >> 5
+	);
+}
+
+tokens lex_memory(std::string_view str)
+{
+	tokens res;
+	std::string lexeme;
+
+	for (int r; (r = next_token(str, lexeme)) != -1;)
+		res.emplace_back(r, r == 0 || r > 3 ? "" : lexeme);
+	return res;
+}
+
+tokens lex_source(strm::buffered_source& src)
+{
+	tokens res;
+	std::string lexeme;
+
+	for (int r; (r = next_token(src, lexeme)) != -1;)
+		res.emplace_back(r, r == 0 || r > 3 ? "" : lexeme);
+	return res;
+}
+
+const std::string input = "int x == 12.5e3 y= 12e 7 " + std::string(100, 'a') + " 3.\n\tz1 ==$rest";
+
+void test_stream()
+{
+	const auto expected = lex_memory(input);
+	assert( expected.size() == 24 );
+
+	// tokens cross the blocks, and some are longer than a block
+	for (std::size_t block : {1, 2, 3, 7, 64, 4096})
+	{
+		std::istringstream in{input};
+		strm::buffered_source src{in, block};
+
+		assert( lex_source(src) == expected );
+		assert( src.buffered().starts_with("$") && src.offset() == input.find('$') );
+		assert( not src.empty() );
+	}
+
+	std::istringstream in{"abc"};
+	strm::buffered_source src{in, 2};
+	assert( strm::match<strm::table_backend>(src, -1, strm::identifier >> 0) == 0 && src.empty() );
+	assert( strm::match(src, -1, strm::identifier >> 0) == -1 && src.offset() == 3 );
+
+	// falls back to "ab" once "abc" is known not to continue into "abcd"
+	std::istringstream fb{"abcx"};
+	strm::buffered_source fallback{fb, 1};
+	assert( strm::match(fallback, -1, strm::lit<"ab"> >> 0, strm::lit<"abcd"> >> 1) == 0 );
+	assert( fallback.offset() == 2 );
+
+	std::istringstream fa{"abcd"};
+	strm::buffered_source first{fa, 1};
+	assert( strm::match<strm::first_accept>(first, -1, strm::lit<"ab"> >> 0, strm::lit<"abcd"> >> 1) == 0 );
+	assert( first.offset() == 2 );
+}
+
+void test_file()
+{
+	std::FILE* file = std::tmpfile();
+	assert( file );
+	std::fwrite(input.data(), 1, input.size(), file);
+	std::rewind(file);
+
+	strm::buffered_source src{file, 5};
+	assert( lex_source(src) == lex_memory(input) );
+	std::fclose(file);
+
+	#ifdef POSIX_SOURCES
+	int fds[2];
+	[[maybe_unused]] const int piped = pipe(fds);
+	assert( piped == 0 );
+
+	[[maybe_unused]] const auto written = write(fds[1], input.data(), input.size());
+	assert( written == static_cast<ssize_t>(input.size()) );
+	close(fds[1]);
+
+	strm::buffered_source pipe_src{fds[0], 16};
+	assert( lex_source(pipe_src) == lex_memory(input) );
+	close(fds[0]);
+	#endif
+}
+
+// a stream buffer which counts the reads
+struct counting_buf : std::stringbuf
+{
+	using std::stringbuf::stringbuf;
+
+	std::streamsize xsgetn(char* dst, std::streamsize n) override
+	{
+		++reads;
+		return std::stringbuf::xsgetn(dst, n);
+	}
+
+	int reads = 0;
+};
+
+// a token over many blocks isn't scanned again after each of them
+void test_long_token()
+{
+	const std::string word(100000, 'a');
+	counting_buf buf{word + " b"};
+	std::istream in{&buf};
+	strm::buffered_source src{in, 16};
+
+	std::string lexeme;
+	assert( next_token(src, lexeme) == 3 && lexeme == word );
+	assert( buf.reads < 20 );
+
+	assert( next_token(src, lexeme) == 0 && next_token(src, lexeme) == 3 && lexeme == "b" );
+}
+
+// a stream buffer which fails after its first characters
+struct failing_buf : std::streambuf
+{
+	char chars[3] = {'a', 'b', ' '};
+
+	failing_buf() { setg(chars, chars, chars + 3); }
+
+	int_type underflow() override { throw std::runtime_error{"device error"}; }
+};
+
+// a read error isn't the end of the input
+void test_errors()
+{
+	[[maybe_unused]] auto fails = [] (auto& src) {
+		try
+		{
+			while (strm::match(src, -1, strm::identifier >> 0, strm::whitespace >> 1) != -1) {}
+		}
+		catch (const std::system_error&)
+		{
+			return true;
+		}
+		return false;
+	};
+
+	failing_buf buf;
+	std::istream in{&buf};
+	strm::buffered_source stream{in, 2};
+	assert( fails(stream) && in.bad() );
+
+	// a file only open for writing
+	std::FILE* file = std::tmpfile();
+	assert( file );
+	std::FILE* out = std::freopen(nullptr, "w", file);
+	if (out)
+	{
+		strm::buffered_source write_only{out};
+		assert( fails(write_only) );
+		std::fclose(out);
+	}
+
+	#ifdef POSIX_SOURCES
+	// the end of a pipe which is written
+	int fds[2];
+	[[maybe_unused]] const int piped = pipe(fds);
+	assert( piped == 0 );
+
+	strm::buffered_source wrong_end{fds[1]};
+	assert( fails(wrong_end) );
+	close(fds[0]);
+	close(fds[1]);
+	#endif
+}
+
+#ifdef POSIX_SOURCES
+// a temporary file with these contents, removed when closed
+struct temp_file
+{
+	char path[32] = "/tmp/strm_sourceXXXXXX";
+	int fd = mkstemp(path);
+
+	explicit temp_file(std::string_view contents)
+	{
+		assert( fd != -1 );
+
+		[[maybe_unused]] const auto written = write(fd, contents.data(), contents.size());
+		assert( written == static_cast<ssize_t>(contents.size()) );
+	}
+
+	~temp_file()
+	{
+		close(fd);
+		unlink(path);
+	}
+};
+
+void test_mapped()
+{
+	temp_file file{input};
+	strm::mapped_source mapped{file.path};
+
+	assert( mapped.size() == input.size() && mapped.view() == input );
+	assert( mapped.data()[input.size()] == '\0' );
+
+	// lexed in place, up to the zero after the file
+	tokens res;
+	std::string lexeme;
+	const char* src = mapped.data();
+
+	for (int r; (r = next_token(src, lexeme)) != -1;)
+		res.emplace_back(r, r == 0 || r > 3 ? "" : lexeme);
+	assert( res == lex_memory(input) && *src == '$' );
+
+	// a page-aligned file is followed by a zero page, which stops the identifier
+	const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	temp_file aligned{std::string(page, 'a')};
+	strm::mapped_source whole{aligned.fd};
+
+	src = whole.data();
+	assert( strm::match(src, -1, strm::identifier >> 0) == 0 && src == whole.data() + page && *src == '\0' );
+
+	temp_file empty{""};
+	strm::mapped_source none{empty.path};
+	assert( none.size() == 0 && *none.data() == '\0' );
+
+	auto moved = std::move(whole);
+	assert( moved.size() == page && moved.data()[page - 1] == 'a' );
+
+	[[maybe_unused]] bool thrown = false;
+	try
+	{
+		strm::mapped_source missing{"/nonexistent/strm"};
+	}
+	catch (const std::system_error&)
+	{
+		thrown = true;
+	}
+	assert( thrown );
+}
+#endif
+
+int main()
+{
+	test_stream();
+	test_file();
+	test_errors();
+	test_long_token();
+
+	#ifdef POSIX_SOURCES
+	test_mapped();
+	#endif
+}
@@ -1,6 +1,14 @@
 #include <strm/strm.hpp>
+#include <strm/regex.hpp>
 #include <cassert>
 #include <iostream>
+#include <list>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <tuple>
+#include <vector>
 
 constexpr unsigned long hash(std::string_view v)
 {	
@@ -104,6 +112,647 @@ void test_identifier()
 	static_assert( failed(m.get_next('4')) );
 }
 
+void test_classes()
+{
+	// letters and '_' start an identifier, anything else stops it
+	using list = strm::impl::make_matchers_list<strm::identifier_matcher>;
+	static_assert( strm::impl::list_classes<list>.count == 2 );
+	
+	// letters and '_', digits, and the rest
+	using dfa = strm::impl::static_dfa<strm::identifier, strm::int_num>;
+	static_assert( dfa::classes == 3 );
+	static_assert( dfa::table.class_of['a'] == dfa::table.class_of['_'] );
+	static_assert( dfa::table.class_of['0'] != dfa::table.class_of['a'] );
+}
+
+void test_minimize()
+{
+	// "abc" is always an identifier first, so the states which track it are redundant
+	using dfa = strm::impl::static_dfa<strm::identifier, strm::lit<"abc">>;
+	using min = strm::impl::flat_dfa<true, strm::identifier, strm::lit<"abc">>;
+	static_assert( dfa::states == 6 );
+	static_assert( min::states == 3 );
+	
+	auto str = "abc de";
+	auto i = str;
+	
+	auto r = strm::match<strm::table_backend, strm::minimize_states>(i, 
+		-1,
+		strm::identifier  >> 0,
+		strm::lit<"abc">  >> 1
+	);
+	
+	assert( r == 0 && i == str + 3 );
+}
+
+// both backends must give the same results
+template <class... Options>
+auto match_some(const char* str)
+{
+	auto i = str;
+	
+	auto r = strm::match<Options...>(i, 
+		-1,
+		strm::lit<"ab">   >> 0,
+		strm::lit<"abcd"> >> 1,
+		strm::identifier  >> 2,
+		strm::int_num     >> 3,
+		strm::float_num   >> 4,
+		strm::lit<"==">   >> 5,
+		strm::lit<"=">    >> 6
+	);
+	
+	return std::pair{r, i - str};
+}
+
+void test_backends()
+{
+	for (auto str : {"abcx", "abcd", "ab+", "123.5x", "123", "==x", "=x", "$", "x1_y"})
+	{
+		assert( match_some(str) == match_some<strm::table_backend>(str) );
+		assert( (match_some(str) == match_some<strm::table_backend, strm::minimize_states>(str)) );
+	}
+	
+	assert( match_some<strm::table_backend>("abcx") == std::pair(2, std::ptrdiff_t{4}) );
+	assert( match_some<strm::table_backend>("=x")   == std::pair(6, std::ptrdiff_t{1}) );
+	assert( match_some<strm::table_backend>("$")    == std::pair(-1, std::ptrdiff_t{0}) );
+	
+	auto&& str = "12345";
+	auto i = str;
+	
+	auto r = strm::match<strm::table_backend>(i, str + 3, 
+		-1,
+		strm::lit<"12345"> >> 0,
+		strm::int_num      >> 1
+	);
+	
+	assert( r == 1 );
+	assert( i == str + 3 );
+}
+
+struct c_keywords : strm::keyword_set<"int", "in", "if", "inline", "int"> {};
+
+// a keywords case must give the same results as a lit case for each keyword
+template <class... Options>
+auto match_keywords(const char* str)
+{
+	auto i = str;
+	
+	auto r = strm::match<Options...>(i, 
+		-1,
+		strm::keywords_of<c_keywords> >> [] (int k) { return 10 + k; },
+		strm::identifier >> 0,
+		strm::lit<"==">  >> 1
+	);
+	
+	return std::pair{r, i - str};
+}
+
+template <class... Options>
+auto match_lits(const char* str)
+{
+	auto i = str;
+	
+	auto r = strm::match<Options...>(i, 
+		-1,
+		strm::lit<"int">    >> 10,
+		strm::lit<"in">     >> 11,
+		strm::lit<"if">     >> 12,
+		strm::lit<"inline"> >> 13,
+		strm::identifier    >> 0,
+		strm::lit<"==">     >> 1
+	);
+	
+	return std::pair{r, i - str};
+}
+
+void test_keywords()
+{
+	using kw = std::remove_const_t<decltype(strm::keywords<"ab", "abcd", "b">)>;
+	
+	static_assert( kw::trie.size == 6 );
+	static_assert( kw{}.get_next('a').get_next('b').alternative() == 0 );
+	static_assert( kw{}.get_next('a').get_next('b').get_next('c').alternative() == -1 );
+	static_assert( failed(kw{}.get_next('a').get_next('x')) );
+	static_assert( matched(kw{}.get_next('b').get_next('x')) );
+	
+	for (auto str : {"int x", "in", "if(", "inline", "inlin", "integer", "i", "==", "x", "$", "in=="})
+	{
+		assert( match_keywords(str) == match_lits(str) );
+		assert( match_keywords<strm::table_backend>(str) == match_lits(str) );
+	}
+	
+	// falls back from "abc" to "ab"
+	auto&& str = "abcx";
+	auto i = str;
+	
+	auto r = strm::match(i, -1, strm::keywords<"ab", "abcd", "b"> >> [] (int k) { return k; });
+	
+	assert( r == 0 && i == str + 2 );
+}
+
+void test_keyword_identifier()
+{
+	using hash = decltype(c_keywords::hash);
+	
+	static_assert( c_keywords::hash.find("inline", "inline" + 6) == 3 );
+	static_assert( c_keywords::hash.find("int", "int" + 3) == 0 );
+	static_assert( c_keywords::hash.find("inl", "inl" + 3) == -1 );
+	static_assert( c_keywords::hash.find("", "" + 0) == -1 );
+	static_assert( hash::slots >= 2 * 4 );
+	
+	// a keyword case and a classified identifier give the same results
+	for (auto str : {"int x", "in", "if(", "inline", "inlin", "integer", "i", "x", "$"})
+	{
+		auto classify = [] <class... Options> (const char* str) {
+			auto i = str;
+			auto r = strm::match<Options...>(i, 
+				-1,
+				strm::identifier_of<c_keywords> >> [] (int k) { return (k == -1) ? 0 : 10 + k; },
+				strm::lit<"==">                  >> 1
+			);
+			return std::pair{r, i - str};
+		};
+		
+		assert( classify(str) == match_keywords(str) );
+		assert( classify.template operator()<strm::table_backend>(str) == match_keywords(str) );
+	}
+	
+	// the classification happens once the longest match is known
+	std::string_view str = "inline_ if";
+	
+	auto r = strm::match(str, -1, strm::identifier_of<c_keywords> >> [] (int k) { return k; });
+	
+	assert( r == -1 && str == " if" );
+	
+	auto lexer = strm::make_tokenizer(
+		strm::whitespace,
+		-2,
+		strm::identifier_of<c_keywords> >> [] (int k) { return k; }
+	);
+	
+	strm::token<int> batch[8];
+	std::size_t pos = 0;
+	
+	assert( strm::tokenize(lexer, "if inlined in", pos, batch) == 3 );
+	assert( batch[0].kind == 2 && batch[1].kind == -1 && batch[2].kind == 1 );
+}
+
+template <class... Options>
+auto match_first(const char* str)
+{
+	auto i = str;
+	
+	auto r = strm::match<strm::first_accept, Options...>(i, 
+		-1,
+		strm::lit<"ab">   >> 0,
+		strm::lit<"abcd"> >> 1,
+		strm::float_num   >> 2
+	);
+	
+	return std::pair{r, i - str};
+}
+
+void test_policies()
+{
+	for (auto str : {"abcd", "abx", "xyz", "12.5", "$"})
+		assert( match_first(str) == match_first<strm::table_backend>(str) );
+	
+	assert( match_first("abcd") == std::pair(0, std::ptrdiff_t{2}) );
+	assert( match_first("12.5") == std::pair(2, std::ptrdiff_t{1}) );
+	assert( match_first("xyz")  == std::pair(-1, std::ptrdiff_t{0}) );
+	
+	// a single-pass input, with one character of lookahead
+	std::istringstream stream{"abcx abcd"};
+	strm::lookahead_input<1, std::istreambuf_iterator<char>> input{ std::istreambuf_iterator<char>{stream}, {} };
+	
+	auto next = [&] {
+		return strm::match(input, 
+			-1,
+			strm::lit<"ab">   >> 0,
+			strm::lit<"abcd"> >> 1,
+			strm::lit<"cx">   >> 2,
+			strm::lit<" ">    >> 3,
+			strm::lit<"cd">   >> 4
+		);
+	};
+	
+	assert( next() == 0 && input.buffered() == 1 );
+	assert( next() == 2 );
+	assert( next() == 3 );
+	
+	// "abcd" needs two characters of lookahead past "ab"
+	assert( next() == 0 );
+	assert( next() == 4 && input.empty() );
+}
+
+template <class... Options>
+void test_span_with()
+{
+	auto str = "hello 123";
+	auto i = str;
+	
+	auto r = strm::match_span<Options...>(i, 
+		-1,
+		strm::identifier >> 0,
+		strm::int_num    >> 1
+	);
+	
+	assert( r.result == 0 && r.begin == str && r.end == str + 5 && r.text() == "hello" );
+	
+	// actions may take the lexeme, and the alternative after it
+	std::string_view src = "12345if";
+	
+	auto length = [] (std::string_view s) { return int(s.size()); };
+	auto keyword = [] (std::string_view s, int alt) { return s == "if" ? 10 + alt : -2; };
+	
+	for (int expected : {5, 11})
+		assert( strm::match<Options...>(src, -1, strm::int_num >> length, strm::keywords<"in", "if"> >> keyword) == expected );
+	
+	// otherwise, the span is a pair of iterators
+	std::list<char> chars = {'4', '2', ' '};
+	auto it = chars.begin();
+	
+	auto value = [] (std::pair<std::list<char>::iterator, std::list<char>::iterator> p) {
+		int v = 0;
+		for (auto c = p.first; c != p.second; ++c)
+			v = v * 10 + (*c - '0');
+		return v;
+	};
+	
+	assert( strm::match<Options...>(it, chars.end(), -1, strm::int_num >> value) == 42 );
+	assert( *it == ' ' );
+}
+
+void test_span()
+{
+	test_span_with();
+	test_span_with<strm::table_backend>();
+}
+
+template <class... Options>
+void test_values_with()
+{
+	using int_result = std::pair<long long, bool>;
+	
+	auto int_of = [] (std::string_view src) {
+		return strm::match<Options...>(src, 
+			int_result{-1, false}, 
+			strm::int_value<> >> [] (strm::number<long long> n) { return int_result{n.value, n.overflow}; }
+		);
+	};
+	
+	assert( int_of("0") == int_result(0, false) );
+	assert( int_of("123456x") == int_result(123456, false) );
+	assert( int_of("9223372036854775807") == int_result(9223372036854775807, false) );
+	assert( int_of("9223372036854775808") == int_result(9223372036854775807, true) );
+	assert( int_of("x") == int_result(-1, false) );
+	
+	auto float_of = [] (std::string_view src) {
+		return strm::match<Options...>(src, 
+			strm::number<double>{-1}, 
+			strm::float_value<> >> [] (strm::number<double> n) { return n; },
+			strm::identifier    >> strm::number<double>{-2}
+		);
+	};
+	
+	for (auto str : {"0", "12", "12.5", "0.1", ".25", "3.", "1234567890.0987654321", "0.000000000000000000000000000123", "123456789012345678901234567890"})
+		assert( float_of(str).value == std::strtod(str, nullptr) );
+	
+	assert( float_of(std::string(400, '9')).overflow );
+	assert( float_of("abc").value == -2 );
+	
+	// the slow path, on a non-contiguous input
+	std::string digits = "98765432109876543210.123";
+	std::list<char> chars(digits.begin(), digits.end());
+	
+	auto it = chars.begin();
+	auto r = strm::match<Options...>(it, chars.end(), 0.0, strm::float_value<> >> [] (strm::number<double> n) { return n.value; });
+	assert( r == 98765432109876543210.123 && it == chars.end() );
+}
+
+void test_values()
+{
+	test_values_with();
+	test_values_with<strm::table_backend>();
+}
+
+template <class... Options>
+auto match_ilits(const char* str)
+{
+	auto i = str;
+	
+	auto r = strm::match<Options...>(i, 
+		-1,
+		strm::ilit<"select">       >> 0,
+		strm::ilit<"content-type"> >> 1,
+		strm::identifier           >> 2
+	);
+	
+	return std::pair{r, i - str};
+}
+
+void test_ilit()
+{
+	constexpr auto m = strm::ilit<"a-b">;
+	static_assert( m.min() == 'A' && m.max() == 'a' );
+	static_assert( m.get_next('A').min() == '-' && m.get_next('A').max() == '-' );
+	static_assert( m.get_next('a').get_next('-').get_next('B').get_next(0).status() == strm::matched );
+	static_assert( m.get_next('b').status() == strm::failed );
+	
+	using res = std::pair<int, std::ptrdiff_t>;
+	
+	const std::pair<const char*, res> expected[] = {
+		{ "select",         {0, 6} },
+		{ "SeLeCt x",       {0, 6} },
+		{ "SELECTED",       {2, 8} },
+		{ "Content-Type:",  {1, 12} },
+		{ "CONTENT-TYPE",   {1, 12} },
+		{ "content_type",   {2, 12} },
+	};
+	
+	for (auto [str, r] : expected)
+	{
+		assert( match_ilits(str) == r );
+		assert( match_ilits<strm::table_backend>(str) == r );
+	}
+}
+
+// long runs of the characters a state loops on are skipped many at a time, 
+// wherever they end relative to the blocks
+template <class... Options>
+void test_loops_with()
+{
+	for (std::size_t n = 1; n < 200; n += 7)
+	{
+		for (auto end : {"", " ", "+", "\xC3\xA9"})
+		{
+			std::string str = std::string(n, 'a') + "_9" + std::string(n % 70, '5') + end;
+			std::string_view sv = str;
+			
+			assert( strm::match<Options...>(sv, -1, strm::int_num >> 0, strm::identifier >> 1) == 1 );
+			assert( sv == end );
+			
+			auto p = str.c_str();
+			assert( strm::match<Options...>(p, -1, strm::int_num >> 0, strm::identifier >> 1) == 1 );
+			assert( p == str.c_str() + str.size() - std::strlen(end) );
+			
+			// digits, then falls back from a float without exponent
+			std::string num = std::string(n, '7') + "e" + end;
+			sv = num;
+			assert( strm::match<Options...>(sv, -1, strm::float_num >> 0) == 0 );
+			assert( sv.size() == 1 + std::strlen(end) );
+		}
+	}
+}
+
+void test_loops()
+{
+	test_loops_with();
+	test_loops_with<strm::table_backend>();
+	test_loops_with< strm::byte_profile<strm::weights_of("aaaa_55 ")> >();
+}
+
+// a byte_profile only changes the order of the tests, never the result
+constexpr strm::byte_weights skewed = [] {
+	strm::byte_weights w;
+	w.weight[' '] = 10;
+	w.weight['='] = 30;
+	w.weight[0xC3] = 20;
+	return w;
+}();
+
+void test_profile()
+{
+	for (auto str : {"abcx", "abcd", "ab+", "123.5x", "123", "==x", "=x", "$", "x1_y", "", " =", "\xC3\xA9", "9e+"})
+	{
+		const auto expected = match_some(str);
+
+		assert( match_some< strm::byte_profile<strm::weights_of("int x = 42; y == x1;\n")> >(str) == expected );
+		assert( match_some< strm::byte_profile<strm::weights_of("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaa")> >(str) == expected );
+		assert( match_some< strm::byte_profile<strm::weights_of("0123456789 0123456789")> >(str) == expected );
+		assert( match_some< strm::byte_profile<skewed> >(str) == expected );
+		assert( match_some< strm::byte_profile<strm::byte_weights{}> >(str) == expected );
+		assert( (match_some< strm::first_accept, strm::byte_profile<skewed> >(str) == match_some<strm::first_accept>(str)) );
+	}
+}
+
+// the search of the cases, against match at every position
+template <class... Options>
+auto search_some(std::string_view str, auto... cases)
+{
+	std::vector<std::tuple<int, std::ptrdiff_t, std::ptrdiff_t>> found, expected;
+	
+	strm::find_all<Options...>(str, [&] (auto m) { 
+		found.emplace_back(m.result, m.begin - str.data(), m.end - str.data());
+	}, cases...);
+	
+	for (std::size_t k = 0; k <= str.size(); )
+	{
+		auto rest = str.substr(k);
+		const int r = strm::match<strm::table_backend>(rest, -1, cases...);
+		const auto end = str.size() - rest.size();
+		
+		if (r != -1)
+			expected.emplace_back(r, k, end);
+		
+		const bool overlap = (std::is_same_v<Options, strm::overlapping> || ...);
+		k = (r == -1 || overlap || end == k) ? k + 1 : end;
+	}
+	
+	assert( found == expected );
+	
+	// the same search on a NUL-terminated copy
+	if (str.find('\0') == std::string_view::npos)
+	{
+		const std::string copy{str};
+		std::vector<std::tuple<int, std::ptrdiff_t, std::ptrdiff_t>> terminated;
+		
+		strm::find_all<Options...>(copy.c_str(), [&] (auto m) { 
+			terminated.emplace_back(m.result, m.begin - copy.c_str(), m.end - copy.c_str());
+		}, cases...);
+		
+		assert( terminated == expected );
+	}
+	return found.size();
+}
+
+void test_search()
+{
+	auto str = "the value is 0x1F, abcd, bc and 12";
+	auto i = str;
+	
+	auto r = strm::search(i, -1, strm::lit<"abcd"> >> 0, strm::lit<"bc"> >> 1, strm::int_num >> 2);
+	assert( r.result == 2 && r.text() == "0" && i == str + 14 );
+	
+	// the leftmost match wins, even if another one ends before it
+	std::string_view sv = "xabcd";
+	auto s = strm::search(sv, -1, strm::lit<"bc"> >> 1, strm::lit<"abcd"> >> 0);
+	assert( s.result == 0 && s.text() == "abcd" && sv.empty() );
+	
+	sv = "no digits";
+	assert( strm::search(sv, -1, strm::int_num >> 0).result == -1 && sv.empty() );
+	
+	// the NUL-terminated search stops at the end of the input
+	i = "12ab";
+	assert( strm::search(i, -1, strm::lit<"c"> >> 0).result == -1 && *i == 0 );
+	
+	for (auto text : {"abcd bc 12 abc", "aaaab aab", "ababcbcd", "==x=== =", "if iffy 3.5e2", ""})
+	{
+		auto cases = [&] <class... Options> () {
+			return search_some<Options...>(text, 
+				strm::lit<"abcd"> >> 0,
+				strm::lit<"bc">   >> 1,
+				strm::lit<"if">   >> 2,
+				strm::lit<"a">    >> 3,
+				strm::lit<"aab">  >> 4,
+				strm::lit<"===">  >> 5,
+				strm::lit<"=">    >> 6,
+				strm::float_num   >> 7
+			);
+		};
+		cases();
+		cases.template operator()<strm::overlapping>();
+		
+		// a single first byte, and a class of first bytes
+		search_some(text, strm::lit<"ab"> >> 0);
+		search_some(text, strm::identifier >> 0);
+	}
+	
+	// a case which matches the empty string, also after the previous match
+	for (auto text : {"baa", "aab", "", "a", "bab"})
+	{
+		search_some(text, strm::re<"a*"> >> 0);
+		search_some<strm::overlapping>(text, strm::re<"a*"> >> 0, strm::lit<"b"> >> 1);
+	}
+	assert( search_some("baa", strm::re<"a*"> >> 0) == 3 );
+	
+	// skips at least 8 characters at a time
+	std::string big(1000, '.');
+	big += "abcd";
+	assert( search_some(big, strm::lit<"abcd"> >> 0, strm::lit<"x"> >> 1) == 1 );
+	assert( search_some(big, strm::lit<"abcd"> >> 0, strm::lit<"x"> >> 1, strm::lit<"y"> >> 2, strm::lit<"z"> >> 3, strm::lit<"w"> >> 4) == 1 );
+	
+	// more first bytes than a word can test : ranges of bytes, and a set for strcspn
+	big += " 1.5 x12 y";
+	assert( search_some(big, strm::int_num >> 0, strm::lit<"y"> >> 1) == 4 );
+	assert( search_some(big, strm::identifier >> 0) == 3 );
+	assert( search_some(big, strm::lit<"abcd"> >> 0, strm::lit<"1"> >> 1, strm::lit<"2"> >> 2, strm::lit<"5"> >> 3, strm::lit<"y"> >> 4, strm::lit<"q"> >> 5) == 6 );
+}
+
+// the batch against a match of each input
+template <class... Options>
+void test_batch_with()
+{
+	std::vector<std::string> strings;
+	for (int k = 0; k < 100; ++k)
+	{
+		const char* some[] = {"abcx", "abcd", "ab+", "123.5x", "123", "==x", "=x", "$", "x1_y", "", "12e", "ab"};
+		strings.push_back( some[k % 12] + std::string(k % 7, '9') );
+	}
+	
+	auto length = [] (std::string_view s) { return 100 + int(s.size()); };
+	
+	auto run = [&] (auto&& match_all) {
+		std::vector<std::string_view> inputs(strings.begin(), strings.end());
+		std::vector<int> results(inputs.size(), -9);
+		
+		match_all(inputs, results.data(),
+			-1,
+			strm::lit<"ab">   >> 0,
+			strm::lit<"abcd"> >> 1,
+			strm::identifier  >> 2,
+			strm::int_num     >> length,
+			strm::float_num   >> 4,
+			strm::lit<"==">   >> 5,
+			strm::lit<"=">    >> 6
+		);
+		return std::pair{results, inputs};
+	};
+	
+	const auto batch = run([] (auto& inputs, auto out, auto... args) {
+		assert( strm::match_batch<Options...>(inputs, out, args...) == out + inputs.size() );
+	});
+	
+	const auto single = run([] (auto& inputs, auto out, auto... args) {
+		for (auto& sv : inputs)
+			*out++ = strm::match<strm::table_backend, Options...>(sv, args...);
+	});
+	
+	assert( batch == single );
+}
+
+void test_batch()
+{
+	test_batch_with();
+	test_batch_with<strm::first_accept>();
+	test_batch_with<strm::minimize_states>();
+	
+	// a partial match, then the default : the characters read are consumed, as with match
+	for (auto str : {"abx", "ab", "abcx"})
+	{
+		std::string_view alone = str;
+		const int expected = strm::match(alone, -1, strm::lit<"abcd"> >> 0, strm::lit<"x"> >> 1);
+		
+		std::vector<std::string_view> inputs{ str, "x", str };
+		int results[3];
+		strm::match_batch(inputs, results, -1, strm::lit<"abcd"> >> 0, strm::lit<"x"> >> 1);
+		
+		assert( results[0] == expected && results[1] == 1 && results[2] == expected );
+		assert( inputs[0] == alone && inputs[1].empty() && inputs[2] == alone );
+	}
+	std::string_view partial[] = { "abx" };
+	int partial_result;
+	strm::match_batch(partial, &partial_result, -1, strm::lit<"abcd"> >> 0);
+	assert( partial_result == -1 && partial[0] == "x" );
+	
+	std::vector<std::string_view> none;
+	int* out = nullptr;
+	assert( strm::match_batch(none, out, -1, strm::identifier >> 0) == out );
+}
+
+void test_resumable()
+{
+	auto m = strm::make_resumable(
+		-1,
+		strm::lit<"while"> >> 0,
+		strm::identifier   >> 1,
+		strm::int_num      >> 2,
+		strm::float_num    >> 3,
+		strm::lit<"===">   >> 4,
+		strm::lit<"=">     >> 5
+	);
+	
+	std::string_view a = "whi", b = "le(x)";
+	
+	assert( not m.feed(a) );
+	assert( a.empty() && m.state.accept == 1 && m.state.length == 3 );
+	
+	// the state can be saved and restored
+	auto saved = m.state;
+	m.reset();
+	m.state = saved;
+	
+	assert( m.feed(b) == 0 );
+	assert( b == "(x)" && m.length == 5 );
+	
+	// "==" is read as the beginning of "===", then the match falls back to "="
+	std::string_view c = "==", d = "x";
+	
+	assert( not m.feed(c) );
+	assert( m.feed(d) == 5 );
+	assert( m.length == 1 && m.replay == 1 && d == "x" );
+	
+	std::string_view e = "12", f = ".5";
+	
+	assert( not m.feed(e) && not m.feed(f) );
+	assert( m.finish() == 3 && m.length == 4 && m.replay == 0 );
+	
+	std::string_view g = "$";
+	
+	assert( m.feed(g) == -1 && g == "$" && m.length == 0 );
+}
+
 template <auto A, auto B>
 void assert_eq(){
 	static_assert( A == B );
@@ -111,6 +760,20 @@ void assert_eq(){
 
 int main(){
 	
+	test_backends();
+	test_minimize();
+	test_policies();
+	test_span();
+	test_values();
+	test_ilit();
+	test_search();
+	test_batch();
+	test_loops();
+	test_profile();
+	test_resumable();
+	test_keywords();
+	test_keyword_identifier();
+	
 	auto&& src = "hello123";
 	auto it = src;
 	
@@ -227,4 +890,62 @@ int main(){
 		std::cout << i << std::endl;
 		assert( *i == '+' ); 
 	}
+	
+	// falling back to a shorter match
+	{
+		auto&& str = "abcx";
+		auto i = str;
+		
+		auto r = strm::match(i, 
+			-1,
+			strm::lit<"ab">   >> 0,
+			strm::lit<"abcd"> >> 1
+		);
+		
+		assert( r == 0 );
+		assert( *i == 'c' );
+	}
+	
+	// bounded input, not NUL-terminated
+	{
+		auto&& str = "12345";
+		auto i = str;
+		
+		auto r = strm::match(i, str + 3, 
+			-1,
+			strm::lit<"12345"> >> 0,
+			strm::int_num      >> 1
+		);
+		
+		assert( r == 1 );
+		assert( i == str + 3 );
+	}
+	
+	// embedded zero bytes
+	{
+		const char str[] = {'a', '\0', 'b', 'c'};
+		auto i = str;
+		
+		auto r = strm::match(i, str + sizeof(str), 
+			-1,
+			strm::lit<"a">      >> 0,
+			strm::lit<"a\0b">   >> 1
+		);
+		
+		assert( r == 1 );
+		assert( *i == 'c' );
+	}
+	
+	{
+		std::string_view str = "while(x)";
+		
+		auto r = strm::match(str, 
+			-1,
+			strm::lit<"while"> >> 0,
+			strm::identifier   >> 1
+		);
+		
+		assert( r == 0 );
+		assert( str == "(x)" );
+	}
 }
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include <strm/unicode.hpp>
+#include <cassert>
+#include <string_view>
+#include <utility>
+
+constexpr bool matches(auto m, std::string_view str)
+{
+	for (char c : str)
+	{
+		m = m.get_next(c);
+		if (m.status() != strm::running)
+			return false;
+	}
+	return m.get_next(0).status() == strm::matched;
+}
+
+// the bytes which continue m are within [min, max], whatever the signedness of char
+constexpr bool covers(auto m)
+{
+	for (int b = 0; b < 256; ++b)
+	{
+		const char c = static_cast<char>(b);
+		if (m.get_next(c).status() == strm::running && (c < m.min() || c > m.max()))
+			return false;
+	}
+	return true;
+}
+
+void test_identifier()
+{
+	constexpr auto id = strm::utf8_identifier;
+	
+	static_assert( matches(id, "hello_42") );
+	static_assert( matches(id, "_x") );
+	static_assert( matches(id, "na\xC3\xAFve") );                       // naïve
+	static_assert( matches(id, "\xD0\x9F\xD1\x80\xD0\xB8") );           // При
+	static_assert( matches(id, "\xE6\x97\xA5\xE6\x9C\xAC") );           // 日本
+	static_assert( matches(id, "\xF0\x9D\x90\x80") );                   // mathematical bold A
+	static_assert( matches(id, "x\xCC\x81") );                         // a combining accent continues
+	
+	static_assert( not matches(id, "1x") );
+	static_assert( not matches(id, "\xCC\x81") );                      // but doesn't start
+	static_assert( not matches(id, "a\xE2\x82\xAC") );                 // €
+	static_assert( not matches(id, "a\xC3") );                          // truncated
+	static_assert( not matches(id, "a\xC0\x80") );                      // overlong
+	static_assert( not matches(id, "a\xED\xA0\x80") );                  // surrogate
+	
+	static_assert( covers(id) );
+	static_assert( covers(id.get_next('a')) );
+	static_assert( covers(id.get_next('\xE6')) );
+	static_assert( covers(id.get_next('\xF0')) );
+}
+
+// both backends must give the same results
+template <class... Options>
+auto match_some(std::string_view str)
+{
+	auto i = str.data();
+	
+	auto r = strm::match<Options...>(i, str.data() + str.size(),
+		-1,
+		strm::lit<"if">       >> 0,
+		strm::utf8_identifier >> 1,
+		strm::int_num         >> 2
+	);
+	
+	return std::pair{r, i - str.data()};
+}
+
+void test_match()
+{
+	using res = std::pair<int, std::ptrdiff_t>;
+	
+	const std::pair<std::string_view, res> expected[] = {
+		{ "if",                          {0, 2} },
+		{ "ifa",                         {1, 3} },
+		{ "na\xC3\xAFve = 1",            {1, 6} },
+		{ "\xE6\x97\xA5\xE6\x9C\xAC+",   {1, 6} },
+		{ "a\xE2\x82\xAC",               {1, 1} },
+		{ "ab\xC3",                      {1, 2} },
+		{ "ab\xE6\x97",                  {1, 2} },
+		{ "42\xC3\xA9",                  {2, 2} },
+		{ "\xC3\xA9t\xC3\xA9",           {1, 5} },
+		{ "\xE2\x82\xAC",                {-1, 2} }, // stops on the last byte, which fails
+	};
+	
+	for (auto [str, r] : expected)
+	{
+		assert( match_some(str) == r );
+		assert( match_some<strm::table_backend>(str) == r );
+	}
+}
+
+void test_char8()
+{
+	std::u8string_view src = u8"été+42";
+	
+	auto next = [&] {
+		return strm::match<strm::table_backend>(src, 
+			-1, 
+			strm::lit<"if">       >> 0,
+			strm::utf8_identifier >> 1,
+			strm::int_num         >> 2
+		);
+	};
+	
+	assert( next() == 1 && src == u8"+42" );
+	src.remove_prefix(1);
+	assert( next() == 2 && src.empty() );
+	
+	// the switch backend reads char8_t as well
+	const char8_t* it = u8"éa";
+	assert( strm::match(it, -1, strm::lit<"\xC3\xA9"> >> 0) == 0 && *it == u8'a' );
+}
+
+int main()
+{
+	test_identifier();
+	test_match();
+	test_char8();
+}
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+#
+# Generates include/strm/unicode_tables.hpp : the byte-level automaton of a UTF-8 identifier,
+# (XID_Start | '_') XID_Continue*, with the properties of the unicodedata module of this Python.
+#
+#   python3 tools/unicode_tables.py > include/strm/unicode_tables.hpp
+#
+
+import sys
+import unicodedata
+
+def ranges(pred):
+    res, start = [], None
+    for cp in range(0x110001):
+        ok = cp < 0x110000 and not (0xD800 <= cp <= 0xDFFF) and pred(cp)
+        if ok and start is None:
+            start = cp
+        elif not ok and start is not None:
+            res.append((start, cp - 1))
+            start = None
+    return res
+
+# Python identifiers are (XID_Start | '_') XID_Continue*
+xid_start = ranges(lambda cp: chr(cp).isidentifier())
+xid_continue = ranges(lambda cp: ('a' + chr(cp)).isidentifier())
+
+START, IDENT = 0, 1
+
+# state -> list of (byte, next state)
+edges = [[], []]
+
+# the states which read the last n continuation bytes of a character whose
+# remaining bits are in the given ranges, shared between both sets
+nodes = {}
+
+def clip(rs, lo, hi):
+    return tuple((max(a, lo) - lo, min(b, hi) - lo) for a, b in rs if a <= hi and b >= lo)
+
+def node(n, rs):
+    key = (n, rs)
+    if key in nodes:
+        return nodes[key]
+
+    state = len(edges)
+    nodes[key] = state
+    edges.append([])
+
+    span = 64 ** (n - 1)
+    for k in range(64):
+        sub = clip(rs, k * span, (k + 1) * span - 1)
+        if sub:
+            edges[state].append((0x80 + k, IDENT if n == 1 else node(n - 1, sub)))
+    return state
+
+def add_set(state, rs):
+    for b in range(0x80):
+        if clip(rs, b, b):
+            edges[state].append((b, IDENT))
+
+    # the lead byte, the length of the sequence, and the code points it may encode
+    leads = [(b, 1, (b & 0x1F) << 6, 0x80)      for b in range(0xC2, 0xE0)] + \
+            [(b, 2, (b & 0x0F) << 12, 0x800)    for b in range(0xE0, 0xF0)] + \
+            [(b, 3, (b & 0x07) << 18, 0x10000)  for b in range(0xF0, 0xF5)]
+
+    for b, n, base, least in leads:
+        lo = max(base, least)
+        hi = min(base + 64 ** n - 1, 0x10FFFF)
+        sub = tuple((x + lo - base, y + lo - base) for x, y in clip(rs, lo, hi))
+        if sub:
+            edges[state].append((b, node(n, sub)))
+
+add_set(START, xid_start)
+add_set(IDENT, xid_continue)
+
+# runs of consecutive bytes going to the same state
+first, runs = [], []
+for e in edges:
+    first.append(len(runs))
+    for b, s in sorted(e):
+        if runs and len(runs) > first[-1] and runs[-1][1] == b - 1 and runs[-1][2] == s:
+            runs[-1][1] = b
+        else:
+            runs.append([b, b, s])
+first.append(len(runs))
+
+out = sys.stdout
+out.write("// Generated by tools/unicode_tables.py (Unicode %s), do not edit\n\n" % unicodedata.unidata_version)
+out.write("#ifndef STRM_CPP_LIBRARY_UNICODE_TABLES_HEADER\n#define STRM_CPP_LIBRARY_UNICODE_TABLES_HEADER\n\n")
+out.write("namespace strm::impl::xid {\n\n")
+out.write("\t// The UTF-8 automaton of (XID_Start | '_') XID_Continue*. State 0 is the starting state,\n")
+out.write("\t// state 1 the only accepting one, the others read the continuation bytes of a character.\n")
+out.write("\t// The transitions of state s are the runs [first[s], first[s + 1]).\n\n")
+out.write("\tstruct run { unsigned char lo, hi; unsigned short next; };\n\n")
+out.write("\tinline constexpr int states = %d;\n\n" % len(edges))
+
+def write_array(decl, items, per_line):
+    out.write("\t%s = {\n" % decl)
+    for k in range(0, len(items), per_line):
+        out.write("\t\t" + ", ".join(items[k:k + per_line]) + ",\n")
+    out.write("\t};\n\n")
+
+write_array("inline constexpr unsigned short first[%d]" % len(first), [str(f) for f in first], 16)
+write_array("inline constexpr run runs[%d]" % len(runs), ["{0x%02X,0x%02X,%d}" % tuple(r) for r in runs], 8)
+
+out.write("} // STRM::IMPL::XID\n\n#endif\n")